@@ -27,15 +27,19 @@ SRCFILE=$SRCDIR/LeafRegionEntry.cpp
 
 for VERTYPE in VM Versioned
 do
-  for RETYPE in Thin Stats ThinLRU StatsLRU ThinDisk StatsDisk ThinDiskLRU StatsDiskLRU
+  for RETYPE in Thin Stats ThinLRU StatsLRU ThinDisk StatsDisk ThinDiskLRU StatsDiskLRU ThinCountLRU StatsCountLRU ThinDiskCountLRU StatsDiskCountLRU
   do
-    for KEY_INFO in 'ObjectKey KEY_OBJECT' 'IntKey KEY_INT' 'LongKey KEY_LONG' 'UUIDKey KEY_UUID' 'StringKey1 KEY_STRING1' 'StringKey2 KEY_STRING2'
+    for KEY_INFO in 'ObjectKey KEY_OBJECT' 'IntKey KEY_INT' 'LongKey KEY_LONG' 'UUIDKey KEY_UUID' 'StringKey1 KEY_STRING1' 'StringKey2 KEY_STRING2' 'SerializedKey KEY_SERIALIZED'
     do
       for MEMTYPE in Heap OffHeap
       do
       declare -a KEY_ARRAY=($KEY_INFO)
       KEY_CLASS=${KEY_ARRAY[0]}
       KEY_TYPE=${KEY_ARRAY[1]}
+      if [ "$KEY_TYPE" = "KEY_SERIALIZED" ] && [ "$MEMTYPE" = "Heap" ]; then
+        # serialized keys are only stored off-heap
+        continue
+      fi
       BASE=${VERTYPE}${RETYPE}RegionEntry${MEMTYPE}
       OUT=${BASE}${KEY_CLASS}
       WP_ARGS=-Wp,-C,-P,-D${KEY_TYPE},-DPARENT_CLASS=$BASE,-DLEAF_CLASS=$OUT
@@ -51,6 +55,9 @@ do
       if [[ "$RETYPE" = *LRU* ]]; then
         WP_ARGS=${WP_ARGS},-DLRU
       fi
+      if [[ "$RETYPE" = *CountLRU* ]]; then
+        WP_ARGS=${WP_ARGS},-DCOUNT_LRU
+      fi
       if [[ "$MEMTYPE" = "OffHeap" ]]; then
         WP_ARGS=${WP_ARGS},-DOFFHEAP
       fi
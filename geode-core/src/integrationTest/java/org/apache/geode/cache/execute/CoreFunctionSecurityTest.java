@@ -51,8 +51,10 @@ import org.apache.geode.management.internal.cli.functions.GarbageCollectionFunct
 import org.apache.geode.management.internal.cli.functions.GatewayReceiverCreateFunction;
 import org.apache.geode.management.internal.cli.functions.GatewaySenderCreateFunction;
 import org.apache.geode.management.internal.cli.functions.GatewaySenderDestroyFunction;
+import org.apache.geode.management.internal.cli.functions.GetHotKeysFunction;
 import org.apache.geode.management.internal.cli.functions.GetMemberConfigInformationFunction;
 import org.apache.geode.management.internal.cli.functions.GetRegionDescriptionFunction;
+import org.apache.geode.management.internal.cli.functions.GetRegionEntryShapeFunction;
 import org.apache.geode.management.internal.cli.functions.GetRegionsFunction;
 import org.apache.geode.management.internal.cli.functions.GetStackTracesFunction;
 import org.apache.geode.management.internal.cli.functions.GetSubscriptionQueueSizeFunction;
@@ -125,9 +127,11 @@ public class CoreFunctionSecurityTest {
     functionStringMap.put(new GatewaySenderCreateFunction(), "*");
     functionStringMap.put(new GatewaySenderDestroyFunction(), "*");
     functionStringMap.put(new GetClusterConfigurationFunction(), "*");
+    functionStringMap.put(new GetHotKeysFunction(), "*");
     functionStringMap.put(new GetMemberConfigInformationFunction(), "*");
     functionStringMap.put(new GetMemberInformationFunction(), "*");
     functionStringMap.put(new GetRegionDescriptionFunction(), "*");
+    functionStringMap.put(new GetRegionEntryShapeFunction(), "*");
     functionStringMap.put(new GetRegionsFunction(), "*");
     functionStringMap.put(new GetStackTracesFunction(), "*");
     functionStringMap.put(new GetSubscriptionQueueSizeFunction(), "*");
@@ -0,0 +1,112 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache;
+
+import static org.apache.geode.distributed.ConfigurationProperties.LOCATORS;
+import static org.apache.geode.distributed.ConfigurationProperties.MCAST_PORT;
+import static org.assertj.core.api.Assertions.assertThat;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.contrib.java.lang.system.RestoreSystemProperties;
+
+import org.apache.geode.cache.CacheFactory;
+import org.apache.geode.cache.Region;
+import org.apache.geode.cache.RegionShortcut;
+import org.apache.geode.internal.util.concurrent.CustomEntryBinnedConcurrentHashMap;
+
+/**
+ * Runs region operations on regions whose entries are kept in a
+ * {@link CustomEntryBinnedConcurrentHashMap}.
+ */
+public class BinnedRegionEntryMapIntegrationTest {
+
+  private static final int THREADS = 8;
+  private static final int KEYS_PER_THREAD = 20000;
+
+  private InternalCache cache;
+
+  @Rule
+  public RestoreSystemProperties restoreSystemProperties = new RestoreSystemProperties();
+
+  @Before
+  public void setUp() {
+    System.setProperty(CustomEntryBinnedConcurrentHashMap.ENABLED_PROPERTY, "true");
+    cache = (InternalCache) new CacheFactory().set(MCAST_PORT, "0").set(LOCATORS, "").create();
+  }
+
+  @After
+  public void tearDown() {
+    cache.close();
+  }
+
+  @Test
+  public void regionUsesBinnedMap() {
+    Region<Integer, String> region =
+        cache.<Integer, String>createRegionFactory(RegionShortcut.LOCAL).create("region");
+
+    assertThat(((LocalRegion) region).getRegionMap().getCustomEntryConcurrentHashMap())
+        .isInstanceOf(CustomEntryBinnedConcurrentHashMap.class);
+  }
+
+  @Test
+  public void concurrentOperationsWhileTheMapResizes() throws Exception {
+    Region<Integer, String> region =
+        cache.<Integer, String>createRegionFactory(RegionShortcut.REPLICATE).create("region");
+    ExecutorService executor = Executors.newFixedThreadPool(THREADS);
+    try {
+      List<Future<?>> futures = new ArrayList<>();
+      for (int t = 0; t < THREADS; t++) {
+        final int first = t * KEYS_PER_THREAD;
+        futures.add(executor.submit(() -> {
+          for (int key = first; key < first + KEYS_PER_THREAD; key++) {
+            region.put(key, "value-" + key);
+            assertThat(region.get(key)).isEqualTo("value-" + key);
+            // read keys of other threads while their puts resize the map
+            region.get((key + KEYS_PER_THREAD) % (THREADS * KEYS_PER_THREAD));
+            if (key % 3 == 0) {
+              region.destroy(key);
+            }
+          }
+        }));
+      }
+      for (Future<?> future : futures) {
+        future.get();
+      }
+    } finally {
+      executor.shutdownNow();
+    }
+
+    int expectedSize = 0;
+    for (int key = 0; key < THREADS * KEYS_PER_THREAD; key++) {
+      if (key % 3 == 0) {
+        assertThat(region.containsKey(key)).isFalse();
+      } else {
+        assertThat(region.get(key)).isEqualTo("value-" + key);
+        expectedSize++;
+      }
+    }
+    assertThat(region.size()).isEqualTo(expectedSize);
+    assertThat(region.keySet()).hasSize(expectedSize);
+  }
+}
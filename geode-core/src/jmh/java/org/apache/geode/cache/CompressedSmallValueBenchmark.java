@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.cache;
+
+import static org.apache.geode.distributed.ConfigurationProperties.LOG_LEVEL;
+
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import org.apache.geode.compression.Compressor;
+import org.apache.geode.compression.DictionaryCompressor;
+import org.apache.geode.compression.SnappyCompressor;
+import org.apache.geode.internal.cache.CachePerfStats;
+import org.apache.geode.internal.cache.InternalCache;
+import org.apache.geode.pdx.PdxInstance;
+
+/**
+ * This benchmark measures the latency of gets and puts on a region whose values are small PDX
+ * instances of the same type, about 200 bytes when serialized, with each of the compressors. The
+ * compression ratio of the values put while creating the region is printed when the trial ends.
+ */
+@State(Scope.Benchmark)
+@Fork(1)
+public class CompressedSmallValueBenchmark {
+  private static final int ENTRIES = 100_000;
+  private static final String[] CITIES =
+      {"Portland", "Seattle", "San Francisco", "Los Angeles", "Denver", "Chicago", "Boston"};
+  private static final String[] STATUSES = {"ACTIVE", "SUSPENDED", "CLOSED"};
+
+  @Param({"none", "snappy", "dictionary"})
+  public String compressor;
+
+  Cache cache;
+  Region<Integer, PdxInstance> region;
+  PdxInstance[] values;
+
+  @Setup(Level.Trial)
+  public void setup() {
+    cache = new CacheFactory().set(LOG_LEVEL, "warn").create();
+    values = new PdxInstance[ENTRIES];
+    Random random = new Random(0);
+    for (int i = 0; i < ENTRIES; i++) {
+      values[i] = createValue((InternalCache) cache, i, random);
+    }
+    region = createRegion(cache, createCompressor(compressor));
+    for (int i = 0; i < ENTRIES; i++) {
+      region.put(i, values[i]);
+    }
+  }
+
+  @TearDown(Level.Trial)
+  public void tearDown() {
+    CachePerfStats stats = ((InternalCache) cache).getCachePerfStats();
+    if (stats.getTotalPostCompressedBytes() > 0) {
+      System.out.printf("%n%s compression ratio: %.2f%n", compressor,
+          (double) stats.getTotalPreCompressedBytes() / stats.getTotalPostCompressedBytes());
+    }
+    cache.close();
+  }
+
+  @State(Scope.Thread)
+  public static class MyState {
+    Random random = new Random();
+  }
+
+  @Benchmark
+  @Measurement(iterations = 10)
+  @Warmup(iterations = 5)
+  @BenchmarkMode(Mode.AverageTime)
+  @OutputTimeUnit(TimeUnit.NANOSECONDS)
+  public PdxInstance get(MyState state) {
+    return region.get(state.random.nextInt(ENTRIES));
+  }
+
+  @Benchmark
+  @Measurement(iterations = 10)
+  @Warmup(iterations = 5)
+  @BenchmarkMode(Mode.AverageTime)
+  @OutputTimeUnit(TimeUnit.NANOSECONDS)
+  public PdxInstance put(MyState state) {
+    int key = state.random.nextInt(ENTRIES);
+    return region.put(key, values[key]);
+  }
+
+  private static Compressor createCompressor(String name) {
+    switch (name) {
+      case "snappy":
+        return new SnappyCompressor();
+      case "dictionary":
+        return new DictionaryCompressor();
+      default:
+        return null;
+    }
+  }
+
+  private static PdxInstance createValue(InternalCache cache, int id, Random random) {
+    // there is no benchmark.Account class, so gets must return the values as PdxInstances
+    return cache.createPdxInstanceFactory("benchmark.Account", false)
+        .writeInt("id", id)
+        .writeString("name", "account-" + id)
+        .writeString("owner", "customer-" + random.nextInt(10_000))
+        .writeString("city", CITIES[random.nextInt(CITIES.length)])
+        .writeString("status", STATUSES[random.nextInt(STATUSES.length)])
+        .writeString("currency", "USD")
+        .writeDouble("balance", random.nextInt(1_000_000) / 100.0)
+        .writeLong("created", 1_500_000_000_000L + random.nextInt(1_000_000_000))
+        .writeLong("updated", 1_500_000_000_000L + random.nextInt(1_000_000_000))
+        .writeString("notes", "standard account, monthly statements, paperless billing")
+        .create();
+  }
+
+  private Region<Integer, PdxInstance> createRegion(Cache cache, Compressor compressor) {
+    return cache.<Integer, PdxInstance>createRegionFactory(RegionShortcut.LOCAL)
+        .setCompressor(compressor)
+        .create("testRegion");
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.cache;
+
+import static org.apache.geode.distributed.ConfigurationProperties.LOG_LEVEL;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import org.apache.commons.io.FileUtils;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Threads;
+import org.openjdk.jmh.annotations.Warmup;
+
+import org.apache.geode.internal.cache.OverflowWriter;
+
+/**
+ * This benchmark measures the throughput of creates on a synchronous overflow only region that is
+ * over its eviction limit, so every create overflows the value of another entry to disk. Comparing
+ * an overflow writer queue size of zero to a non zero one compares writing evicted values in the
+ * thread that evicts them to writing them in batches on the overflow writer thread.
+ */
+@State(Scope.Benchmark)
+@Fork(1)
+@Threads(4)
+public class OverflowToDiskBenchmark {
+  private static final int MAX_ENTRIES = 1000;
+
+  @Param({"0", "10000"})
+  public String overflowWriterQueueSize;
+
+  Cache cache;
+  Region<String, byte[]> region;
+  File diskDir;
+
+  @Setup(Level.Trial)
+  public void setup() throws IOException {
+    System.setProperty(OverflowWriter.QUEUE_SIZE_PROPERTY, overflowWriterQueueSize);
+    diskDir = Files.createTempDirectory("OverflowToDiskBenchmark").toFile();
+    cache = new CacheFactory().set(LOG_LEVEL, "warn").create();
+    cache.createDiskStoreFactory().setDiskDirs(new File[] {diskDir}).create("overflowStore");
+    region = createRegion(cache, MAX_ENTRIES);
+  }
+
+  @TearDown(Level.Trial)
+  public void tearDown() throws IOException {
+    cache.close();
+    FileUtils.deleteDirectory(diskDir);
+  }
+
+  @State(Scope.Thread)
+  public static class MyState {
+    private static final AtomicInteger threads = new AtomicInteger();
+
+    final String prefix = threads.incrementAndGet() + "-";
+    final byte[] value = new byte[1024];
+    int nextKey;
+  }
+
+  @Benchmark
+  @Measurement(iterations = 20)
+  @Warmup(iterations = 5)
+  @BenchmarkMode(Mode.Throughput)
+  @OutputTimeUnit(TimeUnit.MILLISECONDS)
+  public byte[] createEntry(MyState state) {
+    return region.put(state.prefix + state.nextKey++, state.value);
+  }
+
+  private Region<String, byte[]> createRegion(Cache cache, int maxSize) {
+    Region<String, byte[]> region =
+        cache.<String, byte[]>createRegionFactory(RegionShortcut.LOCAL_OVERFLOW)
+            .setDiskStoreName("overflowStore")
+            .setDiskSynchronous(true)
+            .setEvictionAttributes(EvictionAttributes.createLRUEntryAttributes(maxSize,
+                EvictionAction.OVERFLOW_TO_DISK))
+            .create("testRegion");
+    return region;
+  }
+}
@@ -0,0 +1,121 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.util.concurrent;
+
+import java.util.concurrent.ThreadLocalRandom;
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Threads;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * This benchmark compares the throughput of the segmented {@link CustomEntryConcurrentHashMap}
+ * with the {@link CustomEntryBinnedConcurrentHashMap} that region maps use when
+ * {@link CustomEntryBinnedConcurrentHashMap#ENABLED_PROPERTY} is set. Each operation is measured
+ * with one thread and with as many threads as there are processors, so the results show how each
+ * map scales with concurrent writers.
+ */
+@State(Scope.Benchmark)
+@Fork(1)
+@Warmup(iterations = 5)
+@Measurement(iterations = 10)
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+public class RegionEntryMapBenchmark {
+  private static final int KEYS = 1 << 20;
+
+  @Param({"segmented", "binned"})
+  public String map;
+
+  ConcurrentMapWithReusableEntries<Integer, Integer> entries;
+
+  @Setup(Level.Trial)
+  public void setup() {
+    entries = createMap(map);
+    for (int i = 0; i < KEYS; i++) {
+      entries.put(i, i);
+    }
+  }
+
+  @State(Scope.Thread)
+  public static class MyState {
+    // threads create and remove keys above the existing ones, each starting at its own offset
+    int nextKey = KEYS * (1 + ThreadLocalRandom.current().nextInt(1 << 10));
+  }
+
+  @Benchmark
+  @Threads(1)
+  public Integer put() {
+    return putExistingKey();
+  }
+
+  @Benchmark
+  @Threads(Threads.MAX)
+  public Integer putFromAllProcessors() {
+    return putExistingKey();
+  }
+
+  @Benchmark
+  @Threads(1)
+  public Integer get() {
+    return getExistingKey();
+  }
+
+  @Benchmark
+  @Threads(Threads.MAX)
+  public Integer getFromAllProcessors() {
+    return getExistingKey();
+  }
+
+  @Benchmark
+  @Threads(Threads.MAX)
+  public Integer createAndRemoveFromAllProcessors(MyState state) {
+    Integer key = state.nextKey++;
+    entries.putIfAbsent(key, key);
+    return entries.remove(key);
+  }
+
+  private Integer putExistingKey() {
+    int key = ThreadLocalRandom.current().nextInt(KEYS);
+    return entries.put(key, key);
+  }
+
+  private Integer getExistingKey() {
+    return entries.get(ThreadLocalRandom.current().nextInt(KEYS));
+  }
+
+  private static ConcurrentMapWithReusableEntries<Integer, Integer> createMap(String name) {
+    int concurrencyLevel = CustomEntryConcurrentHashMap.DEFAULT_CONCURRENCY_LEVEL;
+    float loadFactor = CustomEntryConcurrentHashMap.DEFAULT_LOAD_FACTOR;
+    switch (name) {
+      case "binned":
+        return new CustomEntryBinnedConcurrentHashMap<>(KEYS, loadFactor, concurrencyLevel, false,
+            null);
+      default:
+        return new CustomEntryConcurrentHashMap<>(KEYS, loadFactor, concurrencyLevel);
+    }
+  }
+}
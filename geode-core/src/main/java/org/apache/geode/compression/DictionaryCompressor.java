@@ -0,0 +1,370 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.compression;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.Executor;
+import java.util.zip.DataFormatException;
+import java.util.zip.Deflater;
+import java.util.zip.Inflater;
+
+import org.apache.geode.annotations.Immutable;
+import org.apache.geode.annotations.internal.MakeNotStatic;
+import org.apache.geode.logging.internal.executors.LoggingExecutors;
+
+/**
+ * An implementation of {@link Compressor} for regions with many small values that are similar to
+ * each other, such as PDX serialized objects of the same few types. Values like these compress
+ * poorly on their own but compress well against a dictionary of the bytes they have in common.
+ *
+ * <p>
+ * Each value is compressed on its own with DEFLATE, using a dictionary trained from a sample of
+ * the values compressed before it. The dictionary is trained in the background once enough values
+ * have been sampled, and until the first one is ready values are compressed without one. A
+ * compressed value starts with the version of the dictionary it was compressed with, and the
+ * compressor keeps every dictionary it trained, so values compressed before {@link #retrain()} can
+ * still be decompressed.
+ *
+ * <p>
+ * The dictionaries only live in the memory of the compressor instance, so an instance must not be
+ * shared by regions on different members expecting to decompress each other's values. Geode only
+ * stores values compressed in memory, so this is the case for instances given to
+ * {@link org.apache.geode.cache.RegionFactory#setCompressor(Compressor)}. The values sampled for
+ * training are those of every region using the instance, so each region should have its own.
+ *
+ * @since Geode 1.13
+ */
+public class DictionaryCompressor implements Compressor {
+
+  /** The default number of values sampled to train a dictionary. */
+  public static final int DEFAULT_SAMPLE_COUNT = 1000;
+
+  /** The default maximum size of a dictionary, which is also the size of the DEFLATE window. */
+  public static final int DEFAULT_MAX_DICTIONARY_SIZE = 32 * 1024;
+
+  /** The most dictionaries an instance can train since the version is stored in one byte. */
+  public static final int MAX_DICTIONARY_VERSION = 255;
+
+  /** The length of the byte sequences counted when training a dictionary. */
+  private static final int SEQUENCE_LENGTH = 8;
+
+  /** The most idle deflaters and inflaters kept for reuse; the others end when they are done */
+  private static final int POOL_SIZE = 2 * Runtime.getRuntime().availableProcessors();
+
+  @MakeNotStatic
+  private static final BlockingQueue<Deflater> DEFLATERS = new ArrayBlockingQueue<>(POOL_SIZE);
+
+  @MakeNotStatic
+  private static final BlockingQueue<Inflater> INFLATERS = new ArrayBlockingQueue<>(POOL_SIZE);
+
+  @Immutable
+  private static final Executor TRAINER =
+      LoggingExecutors.newThreadOnEachExecute("DictionaryCompressor Trainer");
+
+  private final int sampleCount;
+
+  private final int maxDictionarySize;
+
+  /**
+   * The trained dictionaries, indexed by version. Version zero is compression without a
+   * dictionary. Replaced, not modified, when a dictionary is trained.
+   */
+  private volatile byte[][] dictionaries = new byte[][] {null};
+
+  /** The values sampled for the next dictionary, or null if no values are being sampled. */
+  private volatile List<byte[]> samples;
+
+  /** True from when sampling starts until the dictionary trained from the samples is added */
+  private boolean training = true;
+
+  /**
+   * Create a new instance of the DictionaryCompressor that trains its first dictionary from
+   * {@link #DEFAULT_SAMPLE_COUNT} values.
+   */
+  public DictionaryCompressor() {
+    this(DEFAULT_SAMPLE_COUNT, DEFAULT_MAX_DICTIONARY_SIZE);
+  }
+
+  /**
+   * Create a new instance of the DictionaryCompressor.
+   *
+   * @param sampleCount the number of values sampled to train a dictionary
+   * @param maxDictionarySize the maximum size of a dictionary, at most 32K
+   */
+  public DictionaryCompressor(int sampleCount, int maxDictionarySize) {
+    if (sampleCount <= 0) {
+      throw new IllegalArgumentException("sampleCount must be positive");
+    }
+    if (maxDictionarySize <= 0 || maxDictionarySize > DEFAULT_MAX_DICTIONARY_SIZE) {
+      throw new IllegalArgumentException(
+          "maxDictionarySize must be between 1 and " + DEFAULT_MAX_DICTIONARY_SIZE);
+    }
+    this.sampleCount = sampleCount;
+    this.maxDictionarySize = maxDictionarySize;
+    this.samples = new ArrayList<>(sampleCount);
+  }
+
+  /**
+   * Returns the version of the dictionary new values are compressed with, zero if no dictionary
+   * has been trained yet.
+   */
+  public int getDictionaryVersion() {
+    return dictionaries.length - 1;
+  }
+
+  /**
+   * Starts sampling the values being compressed to train a new version of the dictionary, for
+   * example after the values stored in the region have changed shape. Values keep being compressed
+   * with the current dictionary until the new one is trained.
+   *
+   * @return false if a dictionary is already being trained or the instance has trained
+   *         {@link #MAX_DICTIONARY_VERSION} dictionaries
+   */
+  public synchronized boolean retrain() {
+    if (training || getDictionaryVersion() >= MAX_DICTIONARY_VERSION) {
+      return false;
+    }
+    training = true;
+    samples = new ArrayList<>(sampleCount);
+    return true;
+  }
+
+  @Override
+  public byte[] compress(byte[] input) {
+    final byte[][] dictionaries = this.dictionaries;
+    final int version = dictionaries.length - 1;
+    sample(input);
+
+    // the header is the dictionary version followed by the uncompressed length as a varint
+    int length = input.length;
+    byte[] output = new byte[6 + length + (length >> 12) + (length >> 14) + 8];
+    int position = 0;
+    output[position++] = (byte) version;
+    while ((length & ~0x7F) != 0) {
+      output[position++] = (byte) ((length & 0x7F) | 0x80);
+      length >>>= 7;
+    }
+    output[position++] = (byte) length;
+
+    Deflater deflater = DEFLATERS.poll();
+    if (deflater == null) {
+      deflater = new Deflater(Deflater.DEFAULT_COMPRESSION, true);
+    }
+    try {
+      if (dictionaries[version] != null) {
+        deflater.setDictionary(dictionaries[version]);
+      }
+      deflater.setInput(input);
+      deflater.finish();
+      while (!deflater.finished()) {
+        if (position == output.length) {
+          output = Arrays.copyOf(output, output.length * 2);
+        }
+        position += deflater.deflate(output, position, output.length - position);
+      }
+    } finally {
+      deflater.reset();
+      if (!DEFLATERS.offer(deflater)) {
+        deflater.end();
+      }
+    }
+    // Inflater without a zlib wrapper may need an extra dummy byte after the compressed data
+    return Arrays.copyOf(output, position + 1);
+  }
+
+  @Override
+  public byte[] decompress(byte[] input) {
+    if (input.length == 0) {
+      throw new CompressionException("Compressed value has no header");
+    }
+    final int version = input[0] & 0xFF;
+    final byte[][] dictionaries = this.dictionaries;
+    if (version >= dictionaries.length) {
+      throw new CompressionException(
+          "Compressed value uses unknown dictionary version " + version);
+    }
+
+    int position = 1;
+    int length = 0;
+    for (int shift = 0;; shift += 7) {
+      if (position == input.length || shift > 28) {
+        throw new CompressionException("Compressed value has a corrupt header");
+      }
+      final byte b = input[position++];
+      length |= (b & 0x7F) << shift;
+      if ((b & 0x80) == 0) {
+        break;
+      }
+    }
+
+    final byte[] output = new byte[length];
+    Inflater inflater = INFLATERS.poll();
+    if (inflater == null) {
+      inflater = new Inflater(true);
+    }
+    try {
+      if (dictionaries[version] != null) {
+        inflater.setDictionary(dictionaries[version]);
+      }
+      inflater.setInput(input, position, input.length - position);
+      int inflated = 0;
+      while (inflated < length && !inflater.finished()) {
+        final int n = inflater.inflate(output, inflated, length - inflated);
+        if (n == 0 && (inflater.needsInput() || inflater.needsDictionary())) {
+          break;
+        }
+        inflated += n;
+      }
+      if (inflated != length) {
+        throw new CompressionException("Compressed value is truncated");
+      }
+    } catch (DataFormatException e) {
+      throw new CompressionException(e);
+    } finally {
+      inflater.reset();
+      if (!INFLATERS.offer(inflater)) {
+        inflater.end();
+      }
+    }
+    return output;
+  }
+
+  private void sample(byte[] input) {
+    if (samples == null) {
+      // not training, which is the common case, so avoid the lock
+      return;
+    }
+    final List<byte[]> trainingSamples;
+    synchronized (this) {
+      if (samples == null) {
+        return;
+      }
+      samples.add(input.clone());
+      if (samples.size() < sampleCount) {
+        return;
+      }
+      trainingSamples = samples;
+      samples = null;
+    }
+    // training takes a while, so it is not done by the thread compressing the value
+    TRAINER.execute(() -> {
+      byte[] dictionary = null;
+      try {
+        dictionary = train(trainingSamples, maxDictionarySize);
+      } finally {
+        addDictionary(dictionary);
+      }
+    });
+  }
+
+  /**
+   * Adds a dictionary trained in the background, unless it is null or empty, and ends the
+   * training.
+   */
+  private synchronized void addDictionary(byte[] dictionary) {
+    if (dictionary != null && dictionary.length > 0) {
+      final byte[][] newDictionaries = Arrays.copyOf(dictionaries, dictionaries.length + 1);
+      newDictionaries[newDictionaries.length - 1] = dictionary;
+      dictionaries = newDictionaries;
+    }
+    training = false;
+  }
+
+  /**
+   * Builds a dictionary out of the runs of bytes that occur in many of the samples. A run is a
+   * stretch of a sample in which every {@link #SEQUENCE_LENGTH} byte sequence occurs in at least a
+   * tenth of the samples. Runs contained in a more common run are left out, and the runs that are
+   * most common go at the end of the dictionary, where DEFLATE can refer to them with the shortest
+   * distances.
+   */
+  static byte[] train(List<byte[]> samples, int maxDictionarySize) {
+    // count the samples each sequence occurs in, not its occurrences
+    final Map<Long, Integer> sequenceCounts = new HashMap<>();
+    for (byte[] sample : samples) {
+      final Set<Long> sequences = new HashSet<>();
+      for (int i = 0; i + SEQUENCE_LENGTH <= sample.length; i++) {
+        final Long sequence = getSequence(sample, i);
+        if (sequences.add(sequence)) {
+          sequenceCounts.merge(sequence, 1, Integer::sum);
+        }
+      }
+    }
+
+    final int minCount = Math.max(2, samples.size() / 10);
+    final Map<ByteBuffer, Long> runScores = new HashMap<>();
+    for (byte[] sample : samples) {
+      int i = 0;
+      while (i + SEQUENCE_LENGTH <= sample.length) {
+        final int start = i;
+        long score = 0;
+        int count;
+        while (i + SEQUENCE_LENGTH <= sample.length
+            && (count = sequenceCounts.get(getSequence(sample, i))) >= minCount) {
+          score += count;
+          i++;
+        }
+        if (i == start) {
+          i++;
+        } else {
+          final byte[] run = Arrays.copyOfRange(sample, start, i - 1 + SEQUENCE_LENGTH);
+          runScores.merge(ByteBuffer.wrap(run), score, Math::max);
+        }
+      }
+    }
+
+    final List<Map.Entry<ByteBuffer, Long>> runs = new ArrayList<>(runScores.entrySet());
+    runs.sort(Map.Entry.<ByteBuffer, Long>comparingByValue(Comparator.reverseOrder()));
+    final List<byte[]> selected = new ArrayList<>();
+    // ISO-8859-1 maps each byte to one char, so runs already selected can be searched as a string
+    final StringBuilder selectedChars = new StringBuilder();
+    int size = 0;
+    for (Map.Entry<ByteBuffer, Long> run : runs) {
+      final byte[] bytes = run.getKey().array();
+      final String chars = new String(bytes, StandardCharsets.ISO_8859_1);
+      if (size + bytes.length <= maxDictionarySize && selectedChars.indexOf(chars) < 0) {
+        selected.add(bytes);
+        selectedChars.append(chars);
+        size += bytes.length;
+      }
+    }
+
+    final byte[] dictionary = new byte[size];
+    int position = size;
+    for (byte[] bytes : selected) {
+      position -= bytes.length;
+      System.arraycopy(bytes, 0, dictionary, position, bytes.length);
+    }
+    return dictionary;
+  }
+
+  private static Long getSequence(byte[] bytes, int offset) {
+    long sequence = 0;
+    for (int i = offset; i < offset + SEQUENCE_LENGTH; i++) {
+      sequence = (sequence << 8) | (bytes[i] & 0xFF);
+    }
+    return sequence;
+  }
+}
@@ -47,6 +47,7 @@ import org.apache.geode.internal.cache.entries.AbstractOplogDiskRegionEntry;
 import org.apache.geode.internal.cache.entries.AbstractRegionEntry;
 import org.apache.geode.internal.cache.entries.DiskEntry;
 import org.apache.geode.internal.cache.entries.OffHeapRegionEntry;
+import org.apache.geode.internal.cache.entries.SerializedKeyRegionEntry;
 import org.apache.geode.internal.cache.map.CacheModificationLock;
 import org.apache.geode.internal.cache.map.FocusedRegionMap;
 import org.apache.geode.internal.cache.map.RegionMapCommitPut;
@@ -71,6 +72,7 @@ import org.apache.geode.internal.offheap.annotations.Retained;
 import org.apache.geode.internal.sequencelog.EntryLogger;
 import org.apache.geode.internal.size.ReflectionSingleObjectSizer;
 import org.apache.geode.internal.util.concurrent.ConcurrentMapWithReusableEntries;
+import org.apache.geode.internal.util.concurrent.CustomEntryBinnedConcurrentHashMap;
 import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap;
 import org.apache.geode.logging.internal.log4j.api.LogService;
 
@@ -82,6 +84,7 @@ import org.apache.geode.logging.internal.log4j.api.LogService;
 public abstract class AbstractRegionMap extends BaseRegionMap
     implements FocusedRegionMap, CacheModificationLock {
   private static final Logger logger = LogService.getLogger();
+
   private final TxCallbackEventFactory txCallbackEventFactory = new TxCallbackEventFactoryImpl();
 
   /** The underlying map for this region. */
@@ -103,12 +106,22 @@ public abstract class AbstractRegionMap extends BaseRegionMap
 
   private final EntryEventSerialization entryEventSerialization = new EntryEventSerialization();
 
+  /** Set while this map is being bulk loaded; guarded by bulkLoadLock when changed */
+  private volatile RegionMapBulkLoad bulkLoad;
+
+  private final Object bulkLoadLock = new Object();
+
   protected AbstractRegionMap(InternalRegionArguments internalRegionArgs) {
     // do nothing
   }
 
   protected void initialize(RegionMapOwner owner, Attributes attr,
       InternalRegionArguments internalRegionArgs, boolean isLRU) {
+    initialize(owner, attr, internalRegionArgs, isLRU, false);
+  }
+
+  protected void initialize(RegionMapOwner owner, Attributes attr,
+      InternalRegionArguments internalRegionArgs, boolean isLRU, boolean isEntryCountLRU) {
     _setAttributes(attr);
     setOwner(owner);
     setEntryMap(createConcurrentMapWithReusableEntries(attr.initialCapacity, attr.loadFactor,
@@ -131,14 +144,17 @@ public abstract class AbstractRegionMap extends BaseRegionMap
       throw new IllegalStateException("expected LocalRegion or PlaceHolderDiskRegion");
     }
 
-    setEntryFactory(new RegionEntryFactoryBuilder().create(attr.statisticsEnabled, isLRU, isDisk,
-        withVersioning, offHeap));
+    setEntryFactory(new RegionEntryFactoryBuilder().create(attr.statisticsEnabled, isLRU,
+        isEntryCountLRU, isDisk, withVersioning, offHeap));
   }
 
   private ConcurrentMapWithReusableEntries<Object, Object> createConcurrentMapWithReusableEntries(
       int initialCapacity, float loadFactor, int concurrencyLevel, boolean isIdentityMap,
       CustomEntryConcurrentHashMap.HashEntryCreator<Object, Object> entryCreator) {
-    if (entryCreator != null) {
+    if (Boolean.getBoolean(CustomEntryBinnedConcurrentHashMap.ENABLED_PROPERTY)) {
+      return new CustomEntryBinnedConcurrentHashMap<>(initialCapacity, loadFactor,
+          concurrencyLevel, isIdentityMap, entryCreator);
+    } else if (entryCreator != null) {
       return new CustomEntryConcurrentHashMap<>(initialCapacity, loadFactor, concurrencyLevel,
           isIdentityMap, entryCreator);
     } else {
@@ -272,7 +288,12 @@ public abstract class AbstractRegionMap extends BaseRegionMap
 
   @Override
   public RegionEntry putEntryIfAbsent(Object key, RegionEntry regionEntry) {
+    storeKeyOffHeap(regionEntry);
     RegionEntry oldRe = (RegionEntry) getEntryMap().putIfAbsent(key, regionEntry);
+    if (oldRe != null && regionEntry instanceof SerializedKeyRegionEntry) {
+      // the entry lost the race to another one and may be added again, so it gets its key back
+      OffHeapRegionEntryHelper.returnKeyToHeap((SerializedKeyRegionEntry) regionEntry, key);
+    }
     if (oldRe == null && (regionEntry instanceof OffHeapRegionEntry) && _isOwnerALocalRegion()
         && _getOwner().isThisRegionBeingClosedOrDestroyed()) {
       // prevent orphan during concurrent destroy (#48068)
@@ -305,6 +326,7 @@ public abstract class AbstractRegionMap extends BaseRegionMap
     if (getEntryMap().remove(key, regionEntry)) {
       regionEntry.removePhase2();
       if (updateStat) {
+        countBulkLoadEntry(regionEntry);
         incEntryCount(-1);
       }
     }
@@ -324,6 +346,7 @@ public abstract class AbstractRegionMap extends BaseRegionMap
       regionEntry.removePhase2();
       success = true;
       if (updateStat) {
+        countBulkLoadEntry(regionEntry);
         incEntryCount(-1);
       }
     }
@@ -374,6 +397,12 @@ public abstract class AbstractRegionMap extends BaseRegionMap
   public Set<VersionSource> clear(RegionVersionVector rvv, BucketRegion bucketRegion) {
     Set<VersionSource> result = new HashSet<VersionSource>();
 
+    final RegionMapBulkLoad bulkLoad = this.bulkLoad;
+    if (bulkLoad != null) {
+      // the entries waiting for their batch are counted so that the clear can uncount them
+      bulkLoad.discard();
+    }
+
     if (!_isOwnerALocalRegion()) {
       // Fix for #41333. Just clear the the map
       // if we failed during initialization.
@@ -432,7 +461,9 @@ public abstract class AbstractRegionMap extends BaseRegionMap
 
               boolean tombstone = re.isTombstone();
               // note: it.remove() did not reliably remove the entry so we use remove(K,V) here
-              if (getEntryMap().remove(re.getKey(), re)) {
+              final Object key = re.getKey();
+              // a null key means another thread removed the entry and released its key
+              if (key != null && getEntryMap().remove(key, re)) {
                 if (OffHeapRegionEntryHelper.doesClearNeedToCheckForOffHeap()) {
                   GatewaySenderEventImpl.release(re.getValue()); // OFFHEAP _getValue ok
                 }
@@ -475,6 +506,92 @@ public abstract class AbstractRegionMap extends BaseRegionMap
     // By default do nothing; LRU maps needs to override this method
   }
 
+  @Override
+  public void beginBulkLoad() {
+    synchronized (bulkLoadLock) {
+      if (bulkLoad == null) {
+        bulkLoad = new RegionMapBulkLoad(this);
+      }
+      bulkLoad.join();
+    }
+  }
+
+  @Override
+  public void endBulkLoad() {
+    synchronized (bulkLoadLock) {
+      final RegionMapBulkLoad ended = bulkLoad;
+      if (ended == null || !ended.leave()) {
+        return;
+      }
+      // flushed while still set so that operations on the last entries can count them
+      ended.flush();
+      bulkLoad = null;
+    }
+  }
+
+  @Override
+  public RegionMapBulkLoad getBulkLoad() {
+    final RegionMapBulkLoad bulkLoad = this.bulkLoad;
+    if (bulkLoad == null || !bulkLoad.isLoader()) {
+      return null;
+    }
+    return bulkLoad;
+  }
+
+  @Override
+  public void countBulkLoadEntry(RegionEntry re) {
+    final RegionMapBulkLoad bulkLoad = this.bulkLoad;
+    if (bulkLoad != null) {
+      bulkLoad.countEntry(re);
+    }
+  }
+
+  /**
+   * Tell an LRU that a new entry has been created by a bulk load. Unlike
+   * {@link #lruEntryCreate(RegionEntry)} the entry is not appended to the eviction list; that is
+   * done later by {@link #lruBulkLoadEntriesAppend(List, int)}.
+   *
+   * @return the change in the size of the LRU caused by the entry
+   */
+  int lruBulkLoadEntryCreate(RegionEntry e) {
+    // do nothing by default
+    return 0;
+  }
+
+  /**
+   * Tell an LRU to count an entry created by a bulk load on its own, before its batch is flushed.
+   * The entry is appended to the eviction list but nothing is evicted, since the caller holds the
+   * lock of the entry.
+   *
+   * @param lruDelta the change returned by {@link #lruBulkLoadEntryCreate(RegionEntry)} for the
+   *        entry
+   */
+  void lruBulkLoadEntryCount(RegionEntry re, int lruDelta) {
+    // do nothing by default
+  }
+
+  /**
+   * Tell an LRU to add the sizes of a batch of entries created by a bulk load to its total entry
+   * size. The entries are appended by {@link #lruBulkLoadEntriesAppend(List, int)} afterwards.
+   *
+   * @param lruDelta the sum of the changes returned by {@link #lruBulkLoadEntryCreate(RegionEntry)}
+   *        for the entries
+   */
+  void lruBulkLoadEntriesCount(int lruDelta) {
+    // do nothing by default
+  }
+
+  /**
+   * Tell an LRU that entries created by a bulk load can be appended to its eviction list. Called
+   * without holding any entry lock since it may evict.
+   *
+   * @param lruDelta the change in the total entry size already counted by
+   *        {@link #lruBulkLoadEntriesCount(int)} for the entries
+   */
+  void lruBulkLoadEntriesAppend(List<RegionEntry> entries, int lruDelta) {
+    // do nothing by default
+  }
+
   /**
    * Tell an LRU that a new entry has been created
    */
@@ -647,7 +764,19 @@ public abstract class AbstractRegionMap extends BaseRegionMap
       ((AbstractOplogDiskRegionEntry) newRe).setDiskId(oldRe);
       _getOwner().getDiskRegion().replaceIncompatibleEntry((DiskEntry) oldRe, (DiskEntry) newRe);
     }
-    getEntryMap().put(newRe.getKey(), newRe);
+    Object key = newRe.getKey();
+    storeKeyOffHeap(newRe);
+    getEntryMap().put(key, newRe);
+  }
+
+  /**
+   * Moves the key of an entry about to be added to the map off-heap. This is done before the map
+   * is called so that the key is not serialized and allocated while a map lock is held.
+   */
+  private static void storeKeyOffHeap(RegionEntry regionEntry) {
+    if (regionEntry instanceof SerializedKeyRegionEntry) {
+      OffHeapRegionEntryHelper.storeKeyOffHeap((SerializedKeyRegionEntry) regionEntry);
+    }
   }
 
   @Override
@@ -781,6 +910,9 @@ public abstract class AbstractRegionMap extends BaseRegionMap
     boolean cleared = false;
     final LocalRegion owner = _getOwner();
     boolean acceptedVersionTag = entryVersion != null && owner.getConcurrencyChecksEnabled();
+    final RegionMapBulkLoad bulkLoad = getBulkLoad();
+    boolean addedToBulkLoad = false;
+    boolean flushBulkLoad = false;
 
     if (newValue == Token.TOMBSTONE && !owner.getConcurrencyChecksEnabled()) {
       return false;
@@ -822,6 +954,7 @@ public abstract class AbstractRegionMap extends BaseRegionMap
                 }
                 final boolean oldIsTombstone = oldRe.isTombstone();
                 final boolean oldIsDestroyedOrRemoved = oldRe.isDestroyedOrRemoved();
+                countBulkLoadEntry(oldRe);
                 final int oldSize = owner.calculateRegionEntryValueSize(oldRe);
                 if (owner.getIndexManager() != null) {
                   // Due to having no reverse map, we need to be able to generate the oldkey
@@ -903,12 +1036,20 @@ public abstract class AbstractRegionMap extends BaseRegionMap
             if (result) {
               if (newValue == Token.TOMBSTONE) {
                 owner.scheduleTombstone(newRe, entryVersion);
+                incEntryCount(1);
               } else {
-                owner.updateSizeOnCreate(key, owner.calculateRegionEntryValueSize(newRe));
+                final int newSize = owner.calculateRegionEntryValueSize(newRe);
                 EntryLogger.logInitialImagePut(_getOwnerObject(), key, newValue);
-                lruEntryCreate(newRe);
+                if (bulkLoad == null) {
+                  owner.updateSizeOnCreate(key, newSize);
+                  lruEntryCreate(newRe);
+                  incEntryCount(1);
+                } else {
+                  // the size, eviction list and entry count are updated when the batch is flushed
+                  flushBulkLoad = bulkLoad.entryCreated(newRe, newSize);
+                  addedToBulkLoad = true;
+                }
               }
-              incEntryCount(1);
             }
 
             // Update local indexes
@@ -932,6 +1073,10 @@ public abstract class AbstractRegionMap extends BaseRegionMap
             }
           }
           if (!done) {
+            if (addedToBulkLoad) {
+              // counted like the entries created outside of a bulk load
+              countBulkLoadEntry(newRe);
+            }
             removeEntry(key, newRe, false);
             // Update local indexes
             if (owner.getIndexManager() != null && !newRe.isRemoved()) {
@@ -955,7 +1100,11 @@ public abstract class AbstractRegionMap extends BaseRegionMap
       done = false;
       cleared = true;
     } finally {
-      if (done && !deferLRUCallback) {
+      if (addedToBulkLoad) {
+        if (flushBulkLoad) {
+          bulkLoad.flush();
+        }
+      } else if (done && !deferLRUCallback) {
         lruUpdateCallback();
       } else if (!cleared) {
         resetThreadLocals();
@@ -1010,6 +1159,7 @@ public abstract class AbstractRegionMap extends BaseRegionMap
           synchronized (re) {
             if (!re.isRemoved() || re.isTombstone()) {
               Object oldValue = re.getValueInVM(owner);
+              countBulkLoadEntry(re);
               final int oldSize = owner.calculateRegionEntryValueSize(re);
               final boolean wasDestroyedOrRemoved = re.isDestroyedOrRemoved();
               // Create an entry event only if the calling context is
@@ -1139,6 +1289,7 @@ public abstract class AbstractRegionMap extends BaseRegionMap
                       boolean wasDestroyedOrRemoved = oldRe.isDestroyedOrRemoved();
                       {
                         if (!wasTombstone) {
+                          countBulkLoadEntry(oldRe);
                           oldSize = owner.calculateRegionEntryValueSize(oldRe);
                         }
                       }
@@ -1348,6 +1499,7 @@ public abstract class AbstractRegionMap extends BaseRegionMap
                           // entry here
                           return false;
                         }
+                        countBulkLoadEntry(oldRe);
                         final int oldSize = owner.calculateRegionEntryValueSize(oldRe);
                         // added for cq which needs old value. rdubey
                         FilterProfile fp = owner.getFilterProfile();
@@ -1588,6 +1740,7 @@ public abstract class AbstractRegionMap extends BaseRegionMap
                         }
                       }
                       final boolean oldWasTombstone = re.isTombstone();
+                      countBulkLoadEntry(re);
                       final int oldSize = _getOwner().calculateRegionEntryValueSize(re);
                       try {
                         invalidateEntry(event, re, oldSize);
@@ -1804,6 +1957,7 @@ public abstract class AbstractRegionMap extends BaseRegionMap
                 } else {
                   opCompleted = true;
                   final boolean oldWasTombstone = oldRe.isTombstone();
+                  countBulkLoadEntry(oldRe);
                   final int oldSize = owner.calculateRegionEntryValueSize(oldRe);
                   Object oldValue = oldRe.getValueInVM(owner); // OFFHEAP eei
                   // Create an entry event only if the calling context is
@@ -1918,6 +2072,7 @@ public abstract class AbstractRegionMap extends BaseRegionMap
           synchronized (re) {
             // Fix GEODE-3204, do not invalidate the region entry if it is a removed token
             if (!Token.isRemoved(re.getValueAsToken())) {
+              countBulkLoadEntry(re);
               final int oldSize = owner.calculateRegionEntryValueSize(re);
               Object oldValue = re.getValueInVM(owner); // OFFHEAP eei
               // Create an entry event only if the calling context is
@@ -2390,7 +2545,9 @@ public abstract class AbstractRegionMap extends BaseRegionMap
   }
 
   private boolean removeTombstone(RegionEntry re) {
-    return getEntryMap().remove(re.getKey(), re);
+    // a null key means the map was cleared and the key of the entry released
+    final Object key = re.getKey();
+    return key != null && getEntryMap().remove(key, re);
   }
 
   // method used for debugging tombstone count issues
@@ -2128,6 +2128,12 @@ public class BucketRegion extends DistributedRegion implements Bucket {
     updateBucket2Size(0, newSize, SizeOp.CREATE);
   }
 
+  @Override
+  public void updateSizeOnBulkCreate(int entries, long totalSize) {
+    partitionedRegion.getPrStats().incDataStoreEntryCount(entries);
+    updateBucketMemoryStats(totalSize);
+  }
+
   @Override
   public void updateSizeOnRemove(Object key, int oldSize) {
     partitionedRegion.getPrStats().incDataStoreEntryCount(-1);
@@ -2262,7 +2268,7 @@ public class BucketRegion extends DistributedRegion implements Bucket {
     updateBucketMemoryStats(memoryDelta);
   }
 
-  private void updateBucketMemoryStats(final int memoryDelta) {
+  private void updateBucketMemoryStats(final long memoryDelta) {
     if (memoryDelta != 0) {
 
       final long bSize = bytesInMemory.compareAddAndGet(BUCKET_DESTROYED, memoryDelta);
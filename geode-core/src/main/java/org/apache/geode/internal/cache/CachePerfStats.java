@@ -645,6 +645,22 @@ public class CachePerfStats {
     return clock.getTime();
   }
 
+  /**
+   * Returns the statistics about the shape of the region entries created for the region these
+   * stats belong to. Cache wide stats do not track entry shapes.
+   */
+  public RegionEntryShapeStats getEntryShapeStats() {
+    return RegionEntryShapeStats.DISABLED;
+  }
+
+  /**
+   * Returns the tracker of the most frequently accessed keys of the region these stats belong to,
+   * or null if there is none. Cache wide stats do not track hot keys.
+   */
+  public HotKeySketch getHotKeySketch() {
+    return null;
+  }
+
   public int getLoadsCompleted() {
     return stats.getInt(loadsCompletedId);
   }
@@ -460,6 +460,9 @@ public class DiskStoreImpl implements DiskStore {
     }
     if (!isValidating() && !isOfflineCompacting()) {
       startAsyncFlusher();
+      this.overflowWriter = OverflowWriter.createIfEnabled(this);
+    } else {
+      this.overflowWriter = null;
     }
 
     File[] dirs = getDiskDirs();
@@ -1454,6 +1457,17 @@ public class DiskStoreImpl implements DiskStore {
   }
 
   private Thread flusherThread;
+
+  /**
+   * Writes the values evicted by sync overflow only regions, or null if they are written by the
+   * evicting thread.
+   */
+  private final OverflowWriter overflowWriter;
+
+  public OverflowWriter getOverflowWriter() {
+    return this.overflowWriter;
+  }
+
   /**
    * How many threads are waiting to do a put on asyncQueue?
    */
@@ -1522,6 +1536,9 @@ public class DiskStoreImpl implements DiskStore {
   }
 
   public void forceFlush() {
+    if (this.overflowWriter != null) {
+      this.overflowWriter.flush();
+    }
     try {
       flushFlusher(false);
     } catch (InterruptedException ie) {
@@ -2320,6 +2337,9 @@ public class DiskStoreImpl implements DiskStore {
       if (!isOffline()) {
         try {
           // do this before write lock
+          if (this.overflowWriter != null) {
+            this.overflowWriter.close();
+          }
           stopAsyncFlusher();
         } catch (RuntimeException e) {
           if (rte != null) {
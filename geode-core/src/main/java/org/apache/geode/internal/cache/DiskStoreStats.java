@@ -85,6 +85,10 @@ public class DiskStoreStats {
   private static final int uncreatedRecoveredRegionsId;
   private static final int backupsInProgress;
   private static final int backupsCompleted;
+  private static final int overflowWriterQueueSizeId;
+  private static final int overflowWriterBatchesId;
+  private static final int overflowWriterBatchedEntriesId;
+  private static final int overflowWriterCallerWritesId;
 
   static {
     String statName = "DiskStoreStatistics";
@@ -194,7 +198,18 @@ public class DiskStoreStats {
                 "The current number of regions that have been recovered but have not yet been created.",
                 "regions"),
             f.createIntGauge("backupsInProgress", backupsInProgressDesc, "backups"),
-            f.createIntCounter("backupsCompleted", backupsCompletedDesc, "backups"),});
+            f.createIntCounter("backupsCompleted", backupsCompletedDesc, "backups"),
+            f.createIntGauge("overflowWriterQueueSize",
+                "The current number of evicted entries waiting for the overflow writer to write them to disk",
+                "entries"),
+            f.createLongCounter("overflowWriterBatches",
+                "The total number of batches of evicted entries written by the overflow writer",
+                "operations"),
+            f.createLongCounter("overflowWriterBatchedEntries",
+                "The total number of evicted entries written by the overflow writer", "entries"),
+            f.createLongCounter("overflowWriterCallerWrites",
+                "The total number of evicted entries written by the evicting thread because the overflow writer queue was full",
+                "entries"),});
 
     // Initialize id fields
     writesId = type.nameToId("writes");
@@ -242,6 +257,10 @@ public class DiskStoreStats {
     uncreatedRecoveredRegionsId = type.nameToId("uncreatedRecoveredRegions");
     backupsInProgress = type.nameToId("backupsInProgress");
     backupsCompleted = type.nameToId("backupsCompleted");
+    overflowWriterQueueSizeId = type.nameToId("overflowWriterQueueSize");
+    overflowWriterBatchesId = type.nameToId("overflowWriterBatches");
+    overflowWriterBatchedEntriesId = type.nameToId("overflowWriterBatchedEntries");
+    overflowWriterCallerWritesId = type.nameToId("overflowWriterCallerWrites");
   }
 
   ////////////////////// Instance Fields //////////////////////
@@ -563,6 +582,23 @@ public class DiskStoreStats {
     this.stats.incInt(backupsCompleted, 1);
   }
 
+  public long getOverflowWriterQueueSize() {
+    return this.stats.getInt(overflowWriterQueueSizeId);
+  }
+
+  public void incOverflowWriterQueueSize(int delta) {
+    this.stats.incInt(overflowWriterQueueSizeId, delta);
+  }
+
+  public void endOverflowWriterBatch(int count) {
+    this.stats.incLong(overflowWriterBatchesId, 1);
+    this.stats.incLong(overflowWriterBatchedEntriesId, count);
+  }
+
+  public void incOverflowWriterCallerWrites() {
+    this.stats.incLong(overflowWriterCallerWritesId, 1);
+  }
+
   public Statistics getStats() {
     return stats;
   }
@@ -0,0 +1,420 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache;
+
+import java.util.Arrays;
+
+import org.apache.geode.annotations.Immutable;
+import org.apache.geode.internal.InternalStatisticsDisabledException;
+import org.apache.geode.internal.SystemTimer;
+import org.apache.geode.internal.cache.entries.AbstractRegionEntry;
+import org.apache.geode.util.internal.GeodeGlossary;
+
+/**
+ * A hierarchical timer wheel that keeps track of when the entries of a region expire. It is used
+ * instead of an {@link EntryExpiryTask} per entry when {@link #ENABLED_PROPERTY} is set and the
+ * region does not use custom expiration.
+ *
+ * <p>
+ * Entries are bucketed by the tick their expiration time falls in. The lowest level has a bucket
+ * per tick and each higher level has buckets that span {@link #WHEEL_SIZE} times as many ticks as
+ * the buckets of the level below it. When the wheel reaches a bucket of a higher level it spreads
+ * its entries over the levels below.
+ *
+ * <p>
+ * The expiration time of an entry is computed from its last modified and last accessed times each
+ * time the entry is placed, so touching an entry does not move it. An entry that was touched since
+ * it was placed is placed again when its bucket comes up instead of being expired. Buckets hold
+ * their entries in arrays and an entry marks that it is in the wheel with a state bit, so the wheel
+ * costs one array slot per expiring entry and no per entry objects.
+ *
+ * <p>
+ * Destroyed entries are dropped when their bucket comes up. So that they are not held until then,
+ * the wheel is purged of destroyed entries once they make up half of it.
+ *
+ * <p>
+ * Entries that are due are expired through a short lived {@link EntryExpiryTask}, so expiration
+ * actions, events, distributed locks and the idle time check with other members behave the same
+ * way as without the wheel.
+ */
+class EntryExpiryWheel {
+
+  /**
+   * Set to true to use a timer wheel per region for entry expiration.
+   */
+  static final String ENABLED_PROPERTY = GeodeGlossary.GEMFIRE_PREFIX + "EXPIRY_TIMER_WHEEL";
+
+  /**
+   * The number of milliseconds per tick of the timer wheel. Entries expire up to one tick after
+   * their expiration time, never before it.
+   */
+  static final String TICK_PROPERTY = GeodeGlossary.GEMFIRE_PREFIX + "EXPIRY_TIMER_WHEEL_TICK_MS";
+
+  static final boolean ENABLED = Boolean.getBoolean(ENABLED_PROPERTY);
+
+  static final long TICK_MILLIS = Math.max(1, Long.getLong(TICK_PROPERTY, 100));
+
+  static final int WHEEL_BITS = 6;
+
+  static final int WHEEL_SIZE = 1 << WHEEL_BITS;
+
+  private static final int WHEEL_MASK = WHEEL_SIZE - 1;
+
+  static final int LEVELS = 4;
+
+  /**
+   * The wheel is not purged while it holds fewer destroyed entries than this.
+   */
+  static final int MIN_PURGE_COUNT = 1024;
+
+  private final LocalRegion region;
+
+  private final long tickMillis;
+
+  /** The buckets of each level. Guarded by this. */
+  private final Bucket[][] wheels = new Bucket[LEVELS][WHEEL_SIZE];
+
+  /** Entries that expire beyond the span of the highest level. Guarded by this. */
+  private final Bucket overflow = new Bucket();
+
+  /** The last tick whose bucket has been taken for processing. Guarded by this. */
+  private long currentTick;
+
+  /** The number of entries in the wheel. Guarded by this. */
+  private int size;
+
+  /** The number of entries destroyed since the wheel was last purged. Guarded by this. */
+  private int destroyedCount;
+
+  private ExpirationScheduler scheduler;
+
+  private SystemTimer.SystemTimerTask driver;
+
+  EntryExpiryWheel(LocalRegion region, long tickMillis, long now) {
+    this.region = region;
+    this.tickMillis = tickMillis;
+    for (Bucket[] wheel : wheels) {
+      for (int i = 0; i < WHEEL_SIZE; i++) {
+        wheel[i] = new Bucket();
+      }
+    }
+    this.currentTick = Math.floorDiv(now, tickMillis);
+  }
+
+  /**
+   * Starts advancing the wheel once per tick on the given scheduler.
+   */
+  void start(ExpirationScheduler scheduler) {
+    this.scheduler = scheduler;
+    this.driver = new SystemTimer.SystemTimerTask() {
+      @Override
+      public void run2() {
+        advance();
+      }
+
+      @Override
+      public String toString() {
+        return "EntryExpiryWheel for " + region.getFullPath();
+      }
+    };
+    scheduler.scheduleAtFixedRate(driver, tickMillis);
+  }
+
+  /**
+   * Stops the wheel and removes all entries from it.
+   */
+  void close() {
+    if (driver != null && driver.cancel()) {
+      scheduler.incCancels();
+    }
+    clear();
+  }
+
+  /**
+   * Removes all entries from the wheel.
+   */
+  void clear() {
+    synchronized (this) {
+      for (Bucket[] wheel : wheels) {
+        for (Bucket bucket : wheel) {
+          unmark(bucket);
+        }
+      }
+      unmark(overflow);
+      size = 0;
+      destroyedCount = 0;
+    }
+  }
+
+  private static void unmark(Bucket bucket) {
+    final int count = bucket.size;
+    final RegionEntry[] entries = bucket.drain();
+    for (int i = 0; i < count; i++) {
+      ((AbstractRegionEntry) entries[i]).setExpiryScheduled(false);
+    }
+  }
+
+  synchronized int size() {
+    return size;
+  }
+
+  /**
+   * Adds the given entry to the wheel unless it is already in it or does not expire.
+   *
+   * @return true if the entry was added
+   */
+  boolean add(RegionEntry re) {
+    if (!(re instanceof AbstractRegionEntry)) {
+      return false;
+    }
+    final long expirationTime = getExpirationTime(re);
+    if (expirationTime == 0) {
+      return false;
+    }
+    if (!((AbstractRegionEntry) re).setExpiryScheduled(true)) {
+      // already in the wheel; it is placed again when its bucket comes up if it was touched
+      return false;
+    }
+    final long expirationTick = Math.floorDiv(expirationTime + tickMillis - 1, tickMillis);
+    synchronized (this) {
+      // the bucket of the current tick has already been taken
+      place(re, Math.max(expirationTick, currentTick + 1));
+    }
+    return true;
+  }
+
+  /**
+   * Notes that the given entry was destroyed. The wheel is purged of destroyed entries once they
+   * make up half of it, so that their slots do not keep them reachable until their bucket comes up.
+   */
+  void entryDestroyed(RegionEntry re) {
+    if (!(re instanceof AbstractRegionEntry) || !((AbstractRegionEntry) re).isExpiryScheduled()) {
+      return;
+    }
+    synchronized (this) {
+      if (++destroyedCount >= MIN_PURGE_COUNT && destroyedCount >= size / 2) {
+        purge();
+      }
+    }
+  }
+
+  /**
+   * Drops the destroyed entries from all buckets.
+   */
+  private void purge() {
+    for (Bucket[] wheel : wheels) {
+      for (Bucket bucket : wheel) {
+        size -= bucket.purge();
+      }
+    }
+    size -= overflow.purge();
+    destroyedCount = 0;
+  }
+
+  /**
+   * Returns true if the given entry, which is in a bucket, was destroyed and has been unmarked so
+   * that it can be dropped. The mark is cleared before the entry is checked again, so that an add
+   * that found the mark set after the entry was created again can rely on it staying in the wheel.
+   */
+  private static boolean unmarkIfDestroyed(RegionEntry re) {
+    if (!re.isDestroyedOrRemoved()) {
+      return false;
+    }
+    final AbstractRegionEntry entry = (AbstractRegionEntry) re;
+    entry.setExpiryScheduled(false);
+    // an entry created again meanwhile stays unless an add marked it, which will place it again
+    return re.isDestroyedOrRemoved() || !entry.setExpiryScheduled(true);
+  }
+
+  private void advance() {
+    if (region.isDestroyed() || region.getCache().isClosed()) {
+      return;
+    }
+    ExpiryTask.doWithNowSet(region,
+        () -> advanceTo(ExpiryTask.calculateNow(region.getCache())));
+  }
+
+  /**
+   * Processes the buckets of all ticks up to the given time.
+   */
+  void advanceTo(long now) {
+    final long nowTick = Math.floorDiv(now, tickMillis);
+    for (;;) {
+      final RegionEntry[] due;
+      final int dueCount;
+      synchronized (this) {
+        if (currentTick >= nowTick) {
+          return;
+        }
+        currentTick++;
+        cascade();
+        Bucket bucket = wheels[0][(int) (currentTick & WHEEL_MASK)];
+        dueCount = bucket.size;
+        due = bucket.drain();
+        size -= dueCount;
+      }
+      for (int i = 0; i < dueCount; i++) {
+        process(due[i], now);
+      }
+    }
+  }
+
+  /**
+   * Spreads the entries of the higher level buckets that start at the current tick over the levels
+   * below them.
+   */
+  private void cascade() {
+    for (int level = 1; level <= LEVELS; level++) {
+      final int shift = WHEEL_BITS * level;
+      if ((currentTick & ((1L << shift) - 1)) != 0) {
+        return;
+      }
+      final Bucket bucket = level == LEVELS ? overflow
+          : wheels[level][(int) ((currentTick >> shift) & WHEEL_MASK)];
+      final int count = bucket.size;
+      final RegionEntry[] entries = bucket.drain();
+      size -= count;
+      for (int i = 0; i < count; i++) {
+        final RegionEntry re = entries[i];
+        // clear the mark before checking the entry, like process does, so that an add that saw the
+        // mark set can rely on the entry being placed again here
+        ((AbstractRegionEntry) re).setExpiryScheduled(false);
+        if (re.isDestroyedOrRemoved()) {
+          continue;
+        }
+        final long expirationTime = getExpirationTime(re);
+        if (expirationTime == 0 || !((AbstractRegionEntry) re).setExpiryScheduled(true)) {
+          // does not expire, or an add that saw the mark cleared has placed it again
+          continue;
+        }
+        place(re, Math.max(Math.floorDiv(expirationTime + tickMillis - 1, tickMillis),
+            currentTick));
+      }
+    }
+  }
+
+  /**
+   * Puts the entry in the bucket for the given tick. The tick must not be before the current tick.
+   */
+  private void place(RegionEntry re, long expirationTick) {
+    Bucket bucket = overflow;
+    for (int level = 0; level < LEVELS; level++) {
+      final int shift = WHEEL_BITS * (level + 1);
+      if ((expirationTick >> shift) == (currentTick >> shift)) {
+        bucket = wheels[level][(int) ((expirationTick >> (WHEEL_BITS * level)) & WHEEL_MASK)];
+        break;
+      }
+    }
+    bucket.add(re);
+    size++;
+  }
+
+  private void process(RegionEntry re, long now) {
+    ((AbstractRegionEntry) re).setExpiryScheduled(false);
+    if (re.isDestroyedOrRemoved() || !region.usesEntryExpiryWheel()) {
+      return;
+    }
+    final long expirationTime = getExpirationTime(re);
+    if (expirationTime == 0) {
+      return;
+    }
+    if (expirationTime > now) {
+      // touched since it was placed
+      add(re);
+      return;
+    }
+    expire(re);
+  }
+
+  /**
+   * Returns the time the given entry expires according to the region's expiration attributes, or
+   * zero if it does not expire.
+   */
+  long getExpirationTime(RegionEntry re) {
+    long ttl = region.entryTimeToLive;
+    long idle = region.entryIdleTimeout;
+    if (!region.EXPIRY_UNITS_MS) {
+      ttl *= 1000;
+      idle *= 1000;
+    }
+    final long ttlTime = ttl > 0 ? re.getLastModified() + ttl : 0;
+    long idleTime = 0;
+    if (idle > 0) {
+      try {
+        idleTime = re.getLastAccessed() + idle;
+      } catch (InternalStatisticsDisabledException e) {
+        // without an access time the entry does not expire by idle time
+        idleTime = 0;
+      }
+    }
+    if (ttlTime == 0) {
+      return idleTime;
+    } else if (idleTime == 0) {
+      return ttlTime;
+    }
+    return Math.min(ttlTime, idleTime);
+  }
+
+  /**
+   * Expires the given entry the way its expiration task would have.
+   */
+  void expire(RegionEntry re) {
+    new EntryExpiryTask(region, re).run2();
+  }
+
+  private static class Bucket {
+    @Immutable
+    private static final RegionEntry[] EMPTY = new RegionEntry[0];
+
+    private RegionEntry[] entries = EMPTY;
+
+    private int size;
+
+    void add(RegionEntry re) {
+      if (size == entries.length) {
+        entries = Arrays.copyOf(entries, Math.max(8, size * 2));
+      }
+      entries[size++] = re;
+    }
+
+    /**
+     * Drops the destroyed entries from the bucket.
+     *
+     * @return the number of entries dropped
+     */
+    int purge() {
+      int kept = 0;
+      for (int i = 0; i < size; i++) {
+        if (!unmarkIfDestroyed(entries[i])) {
+          entries[kept++] = entries[i];
+        }
+      }
+      final int dropped = size - kept;
+      Arrays.fill(entries, kept, size, null);
+      size = kept;
+      return dropped;
+    }
+
+    /**
+     * Empties the bucket and returns the array that held its entries.
+     */
+    RegionEntry[] drain() {
+      RegionEntry[] result = entries;
+      entries = EMPTY;
+      size = 0;
+      return result;
+    }
+  }
+}
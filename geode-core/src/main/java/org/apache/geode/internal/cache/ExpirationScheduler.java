@@ -94,6 +94,11 @@ public class ExpirationScheduler {
     return addExpiryTask(task) != null;
   }
 
+  /** schedules the given task to run every period milliseconds */
+  public void scheduleAtFixedRate(SystemTimer.SystemTimerTask task, long period) {
+    timer.scheduleAtFixedRate(task, period, period);
+  }
+
   /** @see java.util.Timer#cancel() */
   public void cancel() {
     timer.cancel();
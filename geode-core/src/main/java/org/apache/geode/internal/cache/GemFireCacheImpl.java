@@ -251,6 +251,7 @@ import org.apache.geode.internal.logging.InternalLogWriter;
 import org.apache.geode.internal.monitoring.ThreadsMonitoring;
 import org.apache.geode.internal.net.SocketCreator;
 import org.apache.geode.internal.offheap.MemoryAllocator;
+import org.apache.geode.internal.offheap.OffHeapCompactor;
 import org.apache.geode.internal.security.SecurityService;
 import org.apache.geode.internal.security.SecurityServiceFactory;
 import org.apache.geode.internal.sequencelog.SequenceLoggerImpl;
@@ -696,6 +697,12 @@ public class GemFireCacheImpl implements InternalCache, InternalClientCache, Has
 
   private OffHeapEvictor offHeapEvictor;
 
+  /**
+   * Relocates live off-heap values to reduce fragmentation. Null unless off-heap compaction is
+   * enabled.
+   */
+  private OffHeapCompactor offHeapCompactor;
+
   private ResourceEventsListener resourceEventsListener;
 
   /**
@@ -1041,6 +1048,7 @@ public class GemFireCacheImpl implements InternalCache, InternalClientCache, Has
       // Only bother creating an off-heap evictor if we have off-heap memory enabled.
       if (null != getOffHeapStore()) {
         getInternalResourceManager().addResourceListener(OFFHEAP_MEMORY, getOffHeapEvictor());
+        offHeapCompactor = OffHeapCompactor.startIfEnabled(this, getOffHeapStore());
       }
 
       recordedEventSweeper = createEventTrackerExpiryTask();
@@ -2123,6 +2131,9 @@ public class GemFireCacheImpl implements InternalCache, InternalClientCache, Has
 
         // do this before closing regions
         resourceManager.close();
+        if (offHeapCompactor != null) {
+          offHeapCompactor.close();
+        }
 
         try {
           resourceAdvisor.close();
@@ -0,0 +1,473 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ThreadLocalRandom;
+import java.util.function.LongSupplier;
+
+import org.apache.geode.StatisticDescriptor;
+import org.apache.geode.Statistics;
+import org.apache.geode.StatisticsFactory;
+import org.apache.geode.StatisticsType;
+import org.apache.geode.StatisticsTypeFactory;
+import org.apache.geode.annotations.Immutable;
+import org.apache.geode.cache.Region;
+import org.apache.geode.internal.statistics.StatisticsTypeFactoryImpl;
+import org.apache.geode.management.HotKeyData;
+import org.apache.geode.util.internal.GeodeGlossary;
+
+/**
+ * Keeps track of the most frequently read and written keys of a region with the Space-Saving
+ * algorithm. It monitors at most {@link #CAPACITY_PROPERTY} keys. A key that is not monitored
+ * replaces the monitored key with the lowest count and inherits that count as its error, so every
+ * key whose share of the operations is above 1/capacity is guaranteed to be monitored, and a
+ * monitored key's count never underestimates its true count.
+ *
+ * <p>
+ * Only one in {@link #SAMPLE_INTERVAL_PROPERTY} operations is recorded, chosen at random, and the
+ * reported counts are scaled up accordingly. The counts are kept for windows of
+ * {@link #WINDOW_PROPERTY} milliseconds. The hot keys of the last complete window are reported, or
+ * those of the current window if no window has completed yet, with their rate over that window.
+ *
+ * <p>
+ * Each thread records into one of several stripes, each a sketch of its own with its own lock,
+ * so that threads recording at the same time rarely contend. The stripes are merged when the hot
+ * keys are asked for, and a merged count still never underestimates the key's true count. The
+ * capacity is divided between the stripes, so the sketch monitors at most capacity keys in all,
+ * and the guarantee above holds for a key's share of the operations recorded by each stripe
+ * relative to the stripe's part of the capacity. There are only as many stripes as leave each of
+ * them at least {@link #MIN_STRIPE_CAPACITY} keys. The keys of the last window are kept until the
+ * next one ends, so the sketch references at most twice its capacity in keys.
+ *
+ * <p>
+ * Hot key tracking does not depend on the region's statistics being enabled or on the region
+ * entries keeping statistics. It is disabled unless {@link #CAPACITY_PROPERTY} is set.
+ */
+public class HotKeySketch {
+
+  /**
+   * The number of keys each region monitors. Hot keys are not tracked if this is not greater than
+   * zero.
+   */
+  public static final String CAPACITY_PROPERTY =
+      GeodeGlossary.GEMFIRE_PREFIX + "HOT_KEY_CAPACITY";
+
+  /**
+   * One in this many reads and writes is recorded.
+   */
+  public static final String SAMPLE_INTERVAL_PROPERTY =
+      GeodeGlossary.GEMFIRE_PREFIX + "HOT_KEY_SAMPLE_INTERVAL";
+
+  /**
+   * The number of milliseconds operations are counted for before the counts start over.
+   */
+  public static final String WINDOW_PROPERTY = GeodeGlossary.GEMFIRE_PREFIX + "HOT_KEY_WINDOW_MS";
+
+  private static final int CAPACITY = Integer.getInteger(CAPACITY_PROPERTY, 0);
+
+  private static final int SAMPLE_INTERVAL =
+      Math.max(1, Integer.getInteger(SAMPLE_INTERVAL_PROPERTY, 10));
+
+  private static final long WINDOW = Math.max(1, Long.getLong(WINDOW_PROPERTY, 60000));
+
+  /**
+   * The most sketches the operations are spread over so that threads recording at the same time
+   * rarely contend. A power of two.
+   */
+  private static final int MAX_STRIPES =
+      Integer.highestOneBit(Math.min(64, Runtime.getRuntime().availableProcessors()) * 2 - 1);
+
+  /**
+   * The fewest keys a stripe monitors. A sketch with a smaller capacity has a single stripe.
+   */
+  static final int MIN_STRIPE_CAPACITY = 16;
+
+  @Immutable
+  private static final StatisticsType type;
+
+  //////////////////// Statistic "Id" Fields ////////////////////
+
+  static final int sampledOperationsId;
+  static final int replacedKeysId;
+  static final int monitoredKeysId;
+  static final int hottestKeyOperationsPerSecondId;
+
+  static {
+    String statName = "HotKeyStatistics";
+    String statDescription = "Statistics about the most frequently accessed keys of a region";
+
+    StatisticsTypeFactory f = StatisticsTypeFactoryImpl.singleton();
+
+    type = f.createType(statName, statDescription, new StatisticDescriptor[] {
+        f.createLongCounter("sampledOperations",
+            "The number of reads and writes that were recorded by the hot key tracker.",
+            "operations"),
+        f.createLongCounter("replacedKeys",
+            "The number of times a monitored key with the lowest count was replaced by a key that was not monitored.",
+            "keys"),
+        f.createLongGauge("monitoredKeys", "The current number of monitored keys.", "keys"),
+        f.createLongGauge("hottestKeyOperationsPerSecond",
+            "The estimated rate of operations on the most frequently accessed key in the last complete window.",
+            "operations/sec"),});
+
+    sampledOperationsId = type.nameToId("sampledOperations");
+    replacedKeysId = type.nameToId("replacedKeys");
+    monitoredKeysId = type.nameToId("monitoredKeys");
+    hottestKeyOperationsPerSecondId = type.nameToId("hottestKeyOperationsPerSecond");
+  }
+
+  /** The Statistics object that we delegate most behavior to */
+  private final Statistics stats;
+
+  private final int capacity;
+
+  private final int sampleInterval;
+
+  private final long windowMillis;
+
+  private final LongSupplier clock;
+
+  private final long start;
+
+  /** Each thread records into the stripe picked by its id. */
+  private final Stripe[] stripes;
+
+  /** The window whose hot keys are in lastWindow, or -1 if none has completed. */
+  private volatile long lastWindowIndex = -1;
+
+  /** The hot keys of the last complete window. Guarded by this. */
+  private List<HotKeyData> lastWindow;
+
+  /**
+   * Creates a hot key tracker for a region. Returns null if hot key tracking is disabled.
+   */
+  public static HotKeySketch createIfEnabled(StatisticsFactory factory, String textId) {
+    if (CAPACITY <= 0) {
+      return null;
+    }
+    return new HotKeySketch(factory, textId, CAPACITY, SAMPLE_INTERVAL, WINDOW,
+        System::currentTimeMillis);
+  }
+
+  HotKeySketch(StatisticsFactory factory, String textId, int capacity, int sampleInterval,
+      long windowMillis, LongSupplier clock) {
+    this.stats = factory.createAtomicStatistics(type, textId);
+    this.capacity = capacity;
+    this.sampleInterval = sampleInterval;
+    this.windowMillis = windowMillis;
+    this.clock = clock;
+    this.start = clock.getAsLong();
+    final int stripeCount =
+        Math.min(MAX_STRIPES, Integer.highestOneBit(Math.max(1, capacity / MIN_STRIPE_CAPACITY)));
+    this.stripes = new Stripe[stripeCount];
+    for (int i = 0; i < stripes.length; i++) {
+      stripes[i] = new Stripe(capacity / stripeCount);
+    }
+  }
+
+  public static StatisticsType getStatisticsType() {
+    return type;
+  }
+
+  /**
+   * Returns the hot key tracker of the given region on this member, or null if it does not track
+   * hot keys. The buckets of a partitioned region share the tracker of its data store.
+   */
+  public static HotKeySketch of(Region<?, ?> region) {
+    if (region instanceof PartitionedRegion) {
+      PartitionedRegionDataStore dataStore = ((PartitionedRegion) region).getDataStore();
+      return dataStore == null ? null : dataStore.getCachePerfStats().getHotKeySketch();
+    }
+    if (region instanceof LocalRegion) {
+      return ((LocalRegion) region).getHotKeySketch();
+    }
+    return null;
+  }
+
+  public void close() {
+    this.stats.close();
+  }
+
+  /**
+   * Records a read of the key of the given entry, if this read is sampled.
+   */
+  public void recordRead(RegionEntry re) {
+    if (isSampled()) {
+      record(re.getKey(), false, clock.getAsLong());
+    }
+  }
+
+  /**
+   * Records a write of the key of the given entry, if this write is sampled.
+   */
+  public void recordWrite(RegionEntry re) {
+    if (isSampled()) {
+      record(re.getKey(), true, clock.getAsLong());
+    }
+  }
+
+  private boolean isSampled() {
+    return sampleInterval == 1 || ThreadLocalRandom.current().nextInt(sampleInterval) == 0;
+  }
+
+  void record(Object key, boolean write, long now) {
+    final long windowIndex = getWindowIndex(now);
+    if (windowIndex > 0 && lastWindowIndex != windowIndex - 1) {
+      // the first operation of a window reports the last one
+      reportLastWindow(windowIndex);
+    }
+    this.stats.incLong(sampledOperationsId, 1);
+    final Stripe stripe = stripes[(int) Thread.currentThread().getId() & (stripes.length - 1)];
+    synchronized (stripe) {
+      stripe.roll(windowIndex);
+      stripe.record(key, write);
+    }
+  }
+
+  /**
+   * Returns the monitored keys, most frequently accessed first.
+   */
+  public List<HotKeyData> getHotKeys() {
+    return getHotKeys(clock.getAsLong());
+  }
+
+  List<HotKeyData> getHotKeys(long now) {
+    final long windowIndex = getWindowIndex(now);
+    if (windowIndex > 0) {
+      return reportLastWindow(windowIndex);
+    }
+    return merge(false, windowIndex, now - start);
+  }
+
+  private long getWindowIndex(long now) {
+    return Math.max(0, Math.floorDiv(now - start, windowMillis));
+  }
+
+  /**
+   * Returns the hot keys of the window before the given one, merging them from the stripes the
+   * first time they are asked for.
+   */
+  private synchronized List<HotKeyData> reportLastWindow(long windowIndex) {
+    if (lastWindowIndex != windowIndex - 1) {
+      lastWindow = merge(true, windowIndex, windowMillis);
+      lastWindowIndex = windowIndex - 1;
+      this.stats.setLong(hottestKeyOperationsPerSecondId,
+          lastWindow.isEmpty() ? 0 : Math.round(lastWindow.get(0).getOperationsPerSecond()));
+    }
+    return lastWindow;
+  }
+
+  /**
+   * Merges the counters of the current or the last window of every stripe into the hot keys of
+   * the sketch. A key is only counted by the stripes that monitor it, so a full stripe that does
+   * not monitor a key adds its lowest count to the key's count and error, the most the key could
+   * have been accessed through it.
+   */
+  private List<HotKeyData> merge(boolean last, long windowIndex, long elapsedMillis) {
+    final Map<Object, Counter> merged = new HashMap<>();
+    long missingCount = 0;
+    for (Stripe stripe : stripes) {
+      final Map<Object, Counter> counters;
+      final long minCount;
+      synchronized (stripe) {
+        stripe.roll(windowIndex);
+        counters = stripe.getCounters(last);
+        minCount = last ? stripe.lastMinCount : stripe.minCount();
+      }
+      missingCount += minCount;
+      for (Counter counter : counters.values()) {
+        final Counter sum = merged.computeIfAbsent(counter.key, key -> {
+          final Counter c = new Counter();
+          c.key = key;
+          return c;
+        });
+        sum.count += counter.count - minCount;
+        sum.error += counter.error - minCount;
+        sum.reads += counter.reads;
+        sum.writes += counter.writes;
+      }
+    }
+    for (Counter sum : merged.values()) {
+      // each stripe was counted as its lowest count above and corrected for those monitoring it
+      sum.count += missingCount;
+      sum.error += missingCount;
+    }
+
+    final List<Counter> sorted = new ArrayList<>(merged.values());
+    sorted.sort(Comparator.comparingLong((Counter counter) -> counter.count).reversed());
+    final double seconds = Math.max(1, elapsedMillis) / 1000.0;
+    final int size = Math.min(capacity, sorted.size());
+    final List<HotKeyData> hotKeys = new ArrayList<>(size);
+    for (Counter counter : sorted.subList(0, size)) {
+      final long operations = counter.count * sampleInterval;
+      hotKeys.add(new HotKeyData(String.valueOf(counter.key), operations,
+          counter.error * sampleInterval, counter.reads * sampleInterval,
+          counter.writes * sampleInterval, operations / seconds));
+    }
+    return hotKeys;
+  }
+
+  /**
+   * A Space-Saving sketch of the operations recorded by some of the threads. Guarded by itself.
+   */
+  private class Stripe {
+    private final Map<Object, Counter> counters = new HashMap<>();
+
+    /** A min-heap of the counters by count. */
+    private final Counter[] heap;
+
+    private int size;
+
+    private long windowIndex;
+
+    /** The counters of the window before windowIndex. */
+    private Map<Object, Counter> lastCounters = Collections.emptyMap();
+
+    /** The lowest count of the window before windowIndex if the stripe was full, else zero. */
+    private long lastMinCount;
+
+    Stripe(int capacity) {
+      this.heap = new Counter[capacity];
+    }
+
+    /**
+     * Starts a new window if the given one is after the current one, keeping the counters of the
+     * current one if it is the window right before.
+     */
+    void roll(long windowIndex) {
+      if (windowIndex <= this.windowIndex) {
+        return;
+      }
+      if (windowIndex == this.windowIndex + 1) {
+        lastCounters = getCounters(false);
+        lastMinCount = minCount();
+      } else {
+        lastCounters = Collections.emptyMap();
+        lastMinCount = 0;
+      }
+      stats.incLong(monitoredKeysId, -size);
+      counters.clear();
+      Arrays.fill(heap, 0, size, null);
+      size = 0;
+      this.windowIndex = windowIndex;
+    }
+
+    void record(Object key, boolean write) {
+      Counter counter = counters.get(key);
+      if (counter == null) {
+        if (size < heap.length) {
+          counter = new Counter();
+          counter.index = size;
+          heap[size++] = counter;
+          siftUp(counter.index);
+          stats.incLong(monitoredKeysId, 1);
+        } else {
+          counter = heap[0];
+          counters.remove(counter.key);
+          counter.error = counter.count;
+          counter.reads = 0;
+          counter.writes = 0;
+          stats.incLong(replacedKeysId, 1);
+        }
+        counter.key = key;
+        counters.put(key, counter);
+      }
+      counter.count++;
+      if (write) {
+        counter.writes++;
+      } else {
+        counter.reads++;
+      }
+      siftDown(counter.index);
+    }
+
+    long minCount() {
+      return size < heap.length ? 0 : heap[0].count;
+    }
+
+    Map<Object, Counter> getCounters(boolean last) {
+      if (last) {
+        return lastCounters;
+      }
+      final Map<Object, Counter> copy = new HashMap<>();
+      for (int i = 0; i < size; i++) {
+        copy.put(heap[i].key, heap[i].copy());
+      }
+      return copy;
+    }
+
+    private void siftUp(int index) {
+      final Counter counter = heap[index];
+      while (index > 0) {
+        final int parent = (index - 1) >>> 1;
+        if (heap[parent].count <= counter.count) {
+          break;
+        }
+        heap[index] = heap[parent];
+        heap[index].index = index;
+        index = parent;
+      }
+      heap[index] = counter;
+      counter.index = index;
+    }
+
+    private void siftDown(int index) {
+      final Counter counter = heap[index];
+      for (;;) {
+        int child = (index << 1) + 1;
+        if (child >= size) {
+          break;
+        }
+        if (child + 1 < size && heap[child + 1].count < heap[child].count) {
+          child++;
+        }
+        if (counter.count <= heap[child].count) {
+          break;
+        }
+        heap[index] = heap[child];
+        heap[index].index = index;
+        index = child;
+      }
+      heap[index] = counter;
+      counter.index = index;
+    }
+  }
+
+  private static class Counter {
+    private Object key;
+    private long count;
+    private long error;
+    private long reads;
+    private long writes;
+    private int index;
+
+    Counter copy() {
+      final Counter copy = new Counter();
+      copy.key = key;
+      copy.count = count;
+      copy.error = error;
+      copy.reads = reads;
+      copy.writes = writes;
+      return copy;
+    }
+  }
+}
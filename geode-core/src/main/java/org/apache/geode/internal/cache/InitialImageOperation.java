@@ -1321,7 +1321,13 @@ public class InitialImageOperation {
               // bug 37461: don't allow abort flag to be reset
               boolean isAborted = this.abort; // volatile fetch
               if (!isAborted) {
-                isAborted = !processChunk(m.entries, m.getSender(), m.remoteVersion);
+                // the chunk creates its entries in the region map in bulk
+                InitialImageOperation.this.entries.beginBulkLoad();
+                try {
+                  isAborted = !processChunk(m.entries, m.getSender(), m.remoteVersion);
+                } finally {
+                  InitialImageOperation.this.entries.endBulkLoad();
+                }
                 if (isAborted) {
                   this.abort = true; // volatile store
                 } else {
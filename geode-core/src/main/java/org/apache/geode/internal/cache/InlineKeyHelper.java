@@ -42,13 +42,24 @@ public class InlineKeyHelper {
    * be encoded inline as bytes. Return false if the given string can be encoded inline as chars.
    */
   public static Boolean canStringBeInlineEncoded(String skey) {
+    return canStringBeInlineEncoded(skey, RegionEntryShapeStats.DISABLED);
+  }
+
+  /**
+   * Same as {@link #canStringBeInlineEncoded(String)} but also records the length of the key and,
+   * if it can not be encoded inline, the reason why in the given stats.
+   */
+  public static Boolean canStringBeInlineEncoded(String skey, RegionEntryShapeStats shapeStats) {
+    shapeStats.recordStringKeyLength(skey.length());
     if (skey.length() > getMaxInlineStringKey(MAX_LONGS_USED_FOR_STRING_KEY, true)) {
+      shapeStats.incStringKeyTooLong();
       return null;
     }
     if (isByteEncodingOk(skey)) {
       return Boolean.TRUE;
     } else {
       if (skey.length() > getMaxInlineStringKey(MAX_LONGS_USED_FOR_STRING_KEY, false)) {
+        shapeStats.incStringKeyNotByteEncodable();
         return null;
       } else {
         return Boolean.FALSE;
@@ -289,6 +289,12 @@ public interface InternalRegion extends Region, HasCachePerfStats, RegionEntryCo
 
   void updateSizeOnCreate(Object key, int newBucketSize);
 
+  /**
+   * Same as calling {@link #updateSizeOnCreate(Object, int)} once for each of the given number of
+   * entries, with sizes that add up to totalSize.
+   */
+  void updateSizeOnBulkCreate(int entries, long totalSize);
+
   boolean isCopyOnRead();
 
   Object getValueInVMOrDiskWithoutFaultIn(Object key);
@@ -327,6 +327,12 @@ public class LocalRegion extends AbstractRegion implements LoaderHelperFactory,
   private final ConcurrentHashMap<RegionEntry, EntryExpiryTask> entryExpiryTasks =
       new ConcurrentHashMap<>();
 
+  /**
+   * Tracks entry expiration instead of entryExpiryTasks if the timer wheel is enabled. Created when
+   * the first entry is scheduled. GuardedBy entryExpiryTasks when written.
+   */
+  private volatile EntryExpiryWheel entryExpiryWheel;
+
   private volatile boolean regionInvalid;
 
   /**
@@ -3247,6 +3253,19 @@ public class LocalRegion extends AbstractRegion implements LoaderHelperFactory,
     return cachePerfStats;
   }
 
+  @Override
+  public RegionEntryShapeStats getEntryShapeStats() {
+    return cachePerfStats.getEntryShapeStats();
+  }
+
+  /**
+   * Returns the tracker of the most frequently accessed keys of this region, or null if hot keys
+   * are not tracked.
+   */
+  public HotKeySketch getHotKeySketch() {
+    return cachePerfStats.getHotKeySketch();
+  }
+
   /**
    * regions track the number of tombstones their map holds for size calculations
    */
@@ -7104,6 +7123,11 @@ public class LocalRegion extends AbstractRegion implements LoaderHelperFactory,
 
     entry.updateStatsForPut(lastModified, lastAccessed);
 
+    final HotKeySketch hotKeySketch = getHotKeySketch();
+    if (hotKeySketch != null) {
+      hotKeySketch.recordWrite(entry);
+    }
+
     if (statisticsEnabled && !isProxy()) {
       // do not reschedule if there is already a task in the queue.
       // this prevents bloat in the TimerTask since cancelled tasks
@@ -7165,6 +7189,10 @@ public class LocalRegion extends AbstractRegion implements LoaderHelperFactory,
    * @param regionEntry the entry whose value was accessed
    */
   void updateStatsForGet(final RegionEntry regionEntry, final boolean hit) {
+    final HotKeySketch hotKeySketch = getHotKeySketch();
+    if (hotKeySketch != null && regionEntry != null) {
+      hotKeySketch.recordRead(regionEntry);
+    }
     if (!statisticsEnabled) {
       return;
     }
@@ -7733,6 +7761,11 @@ public class LocalRegion extends AbstractRegion implements LoaderHelperFactory,
     if (!isEntryExpiryPossible()) {
       return;
     }
+    EntryExpiryWheel wheel = entryExpiryWheel;
+    if (wheel != null) {
+      // entries are placed again below with their new expiration times
+      wheel.clear();
+    }
     // OK to ignore transaction since Expiry only done non-tran
     Iterator<RegionEntry> it = entries.regionEntries().iterator();
     if (it.hasNext()) {
@@ -7829,6 +7862,31 @@ public class LocalRegion extends AbstractRegion implements LoaderHelperFactory,
     return null;
   }
 
+  /**
+   * Returns true if entry expiration of this region is tracked by an {@link EntryExpiryWheel}
+   * instead of a task per entry. Custom expiration always uses a task per entry.
+   */
+  boolean usesEntryExpiryWheel() {
+    return EntryExpiryWheel.ENABLED && customEntryIdleTimeout == null
+        && customEntryTimeToLive == null;
+  }
+
+  private EntryExpiryWheel getOrCreateEntryExpiryWheel() {
+    EntryExpiryWheel wheel = entryExpiryWheel;
+    if (wheel == null) {
+      synchronized (entryExpiryTasks) {
+        wheel = entryExpiryWheel;
+        if (wheel == null) {
+          wheel = new EntryExpiryWheel(this, EntryExpiryWheel.TICK_MILLIS,
+              ExpiryTask.calculateNow(cache));
+          wheel.start(cache.getExpirationScheduler());
+          entryExpiryWheel = wheel;
+        }
+      }
+    }
+    return wheel;
+  }
+
   @Override
   public EntryExpiryTask getEntryExpiryTask(Object key) {
     RegionEntry re = getRegionEntry(key);
@@ -7865,6 +7923,11 @@ public class LocalRegion extends AbstractRegion implements LoaderHelperFactory,
       return;
     }
     if (isEntryExpiryPossible()) {
+      if (usesEntryExpiryWheel()) {
+        // an entry that is already in the wheel is checked again when its tick comes up
+        getOrCreateEntryExpiryWheel().add(regionEntry);
+        return;
+      }
       EntryExpiryTask newTask = null;
       EntryExpiryTask oldTask;
       if (ifAbsent) {
@@ -7936,6 +7999,10 @@ public class LocalRegion extends AbstractRegion implements LoaderHelperFactory,
         cache.getExpirationScheduler().incCancels();
       }
     } else {
+      EntryExpiryWheel wheel = entryExpiryWheel;
+      if (wheel != null) {
+        wheel.entryDestroyed(regionEntry);
+      }
       EntryExpiryTask oldTask = entryExpiryTasks.remove(regionEntry);
       if (oldTask != null) {
         if (oldTask.cancel()) {
@@ -7951,6 +8018,13 @@ public class LocalRegion extends AbstractRegion implements LoaderHelperFactory,
     if (entryExpiryTasks == null) {
       return;
     }
+    EntryExpiryWheel wheel = entryExpiryWheel;
+    if (wheel != null) {
+      synchronized (entryExpiryTasks) {
+        entryExpiryWheel = null;
+      }
+      wheel.close();
+    }
     if (entryExpiryTasks.isEmpty()) {
       return;
     }
@@ -10171,6 +10245,11 @@ public class LocalRegion extends AbstractRegion implements LoaderHelperFactory,
     // Only needed by BucketRegion
   }
 
+  @Override
+  public void updateSizeOnBulkCreate(int entries, long totalSize) {
+    // Only needed by BucketRegion
+  }
+
   @Override
   public void updateSizeOnRemove(Object key, int oldSize) {
     // Only needed by BucketRegion
@@ -0,0 +1,220 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.function.Consumer;
+
+import org.apache.logging.log4j.Logger;
+
+import org.apache.geode.CancelException;
+import org.apache.geode.cache.RegionDestroyedException;
+import org.apache.geode.internal.cache.DiskStoreImpl.AsyncDiskEntry;
+import org.apache.geode.internal.cache.entries.DiskEntry;
+import org.apache.geode.logging.internal.executors.LoggingThread;
+import org.apache.geode.logging.internal.log4j.api.LogService;
+import org.apache.geode.util.internal.GeodeGlossary;
+
+/**
+ * Writes the values that LRU eviction overflows to disk for the synchronous overflow only regions
+ * of a disk store on a dedicated thread, instead of in the thread that evicts them.
+ *
+ * <p>
+ * An evicted entry is marked as pending an asynchronous write and queued, the same way eviction
+ * does for asynchronous regions, so its value stays in memory and readable until the writer has
+ * written it, set its {@link DiskId} and released the value. Evicting an entry again before it
+ * has been written does not queue it a second time. The writer drains the queue in batches of up to
+ * {@link #BATCH_SIZE_PROPERTY} entries, so a burst of evictions is appended to the overflow oplog
+ * by one thread, back to back, instead of by each evicting thread contending for the oplog.
+ *
+ * <p>
+ * The queue is bounded by {@link #QUEUE_SIZE_PROPERTY} entries, which limits how much memory
+ * evicted values can hold on to. When it is full the evicting thread writes the value itself. The
+ * writer is disabled unless the queue size is set.
+ */
+public class OverflowWriter {
+  private static final Logger logger = LogService.getLogger();
+
+  /**
+   * The maximum number of evicted entries waiting to be written to disk per disk store. Evicted
+   * values are written by the evicting thread if this is not greater than zero.
+   */
+  public static final String QUEUE_SIZE_PROPERTY =
+      GeodeGlossary.GEMFIRE_PREFIX + "disk.OVERFLOW_WRITER_QUEUE_SIZE";
+
+  /**
+   * The maximum number of evicted entries the writer takes from the queue at once.
+   */
+  public static final String BATCH_SIZE_PROPERTY =
+      GeodeGlossary.GEMFIRE_PREFIX + "disk.OVERFLOW_WRITER_BATCH_SIZE";
+
+  private static final int QUEUE_SIZE = Integer.getInteger(QUEUE_SIZE_PROPERTY, 0);
+
+  private static final int BATCH_SIZE = Math.max(1, Integer.getInteger(BATCH_SIZE_PROPERTY, 256));
+
+  private static final long POLL_MILLIS = 100;
+
+  private final String name;
+
+  private final DiskStoreStats stats;
+
+  private final int batchSize;
+
+  private final Consumer<AsyncDiskEntry> writer;
+
+  private final BlockingQueue<AsyncDiskEntry> queue;
+
+  private final AtomicLong scheduled = new AtomicLong();
+
+  /** The number of scheduled entries that have been written. Guarded by this. */
+  private long written;
+
+  private volatile boolean stopped;
+
+  private Thread thread;
+
+  /**
+   * Creates and starts a writer for a disk store. Returns null if the writer is disabled.
+   */
+  static OverflowWriter createIfEnabled(DiskStoreImpl diskStore) {
+    if (QUEUE_SIZE <= 0) {
+      return null;
+    }
+    OverflowWriter overflowWriter = new OverflowWriter(
+        String.format("Overflow writer for disk store %s", diskStore.getName()),
+        diskStore.getStats(), QUEUE_SIZE, BATCH_SIZE,
+        ade -> DiskEntry.Helper.doAsyncFlush(ade.de, ade.region, ade.tag));
+    overflowWriter.start();
+    return overflowWriter;
+  }
+
+  OverflowWriter(String name, DiskStoreStats stats, int queueSize, int batchSize,
+      Consumer<AsyncDiskEntry> writer) {
+    this.name = name;
+    this.stats = stats;
+    this.batchSize = batchSize;
+    this.writer = writer;
+    this.queue = new ArrayBlockingQueue<>(queueSize);
+  }
+
+  void start() {
+    thread = new LoggingThread(name, this::run);
+    thread.start();
+  }
+
+  /**
+   * Queues an evicted entry whose {@link DiskId} has been marked as pending an asynchronous write.
+   *
+   * @return false if the queue is full or the writer is stopped, in which case the caller must
+   *         write the entry itself
+   */
+  public boolean schedule(AsyncDiskEntry ade) {
+    if (stopped || !queue.offer(ade)) {
+      stats.incOverflowWriterCallerWrites();
+      return false;
+    }
+    scheduled.incrementAndGet();
+    stats.incOverflowWriterQueueSize(1);
+    return true;
+  }
+
+  private void run() {
+    final List<AsyncDiskEntry> batch = new ArrayList<>(batchSize);
+    while (!stopped) {
+      try {
+        AsyncDiskEntry first = queue.poll(POLL_MILLIS, TimeUnit.MILLISECONDS);
+        if (first == null) {
+          continue;
+        }
+        batch.add(first);
+        queue.drainTo(batch, batchSize - 1);
+        writeBatch(batch);
+      } catch (InterruptedException e) {
+        break;
+      }
+    }
+  }
+
+  private void writeBatch(List<AsyncDiskEntry> batch) {
+    final int count = batch.size();
+    try {
+      for (AsyncDiskEntry ade : batch) {
+        try {
+          writer.accept(ade);
+        } catch (RegionDestroyedException | CancelException ignore) {
+          // the region or cache was closed while the entry was queued
+        } catch (RuntimeException e) {
+          logger.warn("{} failed to write an evicted entry of {}", name,
+              ade.region.getFullPath(), e);
+        }
+      }
+    } finally {
+      batch.clear();
+      stats.incOverflowWriterQueueSize(-count);
+      stats.endOverflowWriterBatch(count);
+      synchronized (this) {
+        written += count;
+        notifyAll();
+      }
+    }
+  }
+
+  /**
+   * Waits until every entry that was queued before this call has been written.
+   */
+  public void flush() {
+    final long target = scheduled.get();
+    synchronized (this) {
+      while (written < target && !stopped) {
+        try {
+          wait(POLL_MILLIS);
+        } catch (InterruptedException e) {
+          Thread.currentThread().interrupt();
+          return;
+        }
+      }
+    }
+  }
+
+  /**
+   * Stops the writer thread and writes the entries that are still queued in the calling thread.
+   */
+  void close() {
+    stopped = true;
+    if (thread != null) {
+      boolean interrupted = false;
+      while (thread.isAlive()) {
+        try {
+          thread.join(POLL_MILLIS);
+        } catch (InterruptedException e) {
+          interrupted = true;
+        }
+      }
+      if (interrupted) {
+        Thread.currentThread().interrupt();
+      }
+    }
+    final List<AsyncDiskEntry> remaining = new ArrayList<>(queue.size());
+    queue.drainTo(remaining);
+    if (!remaining.isEmpty()) {
+      writeBatch(remaining);
+    }
+  }
+}
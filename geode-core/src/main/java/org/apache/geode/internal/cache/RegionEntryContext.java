@@ -41,4 +41,11 @@ public interface RegionEntryContext extends HasCachePerfStats {
   void incRecentlyUsed();
 
   InternalCache getCache();
+
+  /**
+   * Returns the statistics that record the shape of the region entries created for this context.
+   */
+  default RegionEntryShapeStats getEntryShapeStats() {
+    return RegionEntryShapeStats.DISABLED;
+  }
 }
@@ -0,0 +1,250 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache;
+
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+import org.apache.geode.StatisticDescriptor;
+import org.apache.geode.Statistics;
+import org.apache.geode.StatisticsFactory;
+import org.apache.geode.StatisticsType;
+import org.apache.geode.StatisticsTypeFactory;
+import org.apache.geode.annotations.Immutable;
+import org.apache.geode.internal.statistics.DummyStatisticsImpl;
+import org.apache.geode.internal.statistics.StatisticsTypeFactoryImpl;
+
+/**
+ * Statistics about the shape of the region entries a {@link RegionEntryFactory} creates for a
+ * region: which leaf class (inline key kind) each entry got, why a key could not be stored inline
+ * and how long string keys are. The counters are updated when an entry is created, so they also
+ * count entries that were created and then discarded, for example on a lost create race.
+ */
+public class RegionEntryShapeStats {
+
+  @Immutable
+  private static final StatisticsType type;
+
+  //////////////////// Statistic "Id" Fields ////////////////////
+
+  static final int objectKeyEntriesId;
+  static final int intKeyEntriesId;
+  static final int longKeyEntriesId;
+  static final int uuidKeyEntriesId;
+  static final int stringKey1EntriesId;
+  static final int stringKey2EntriesId;
+  static final int serializedKeyEntriesId;
+
+  static final int inlineKeysDisabledId;
+  static final int unsupportedKeyClassId;
+  static final int stringKeyTooLongId;
+  static final int stringKeyNotByteEncodableId;
+
+  static final int stringKeysLength0To3Id;
+  static final int stringKeysLength4To7Id;
+  static final int stringKeysLength8To15Id;
+  static final int stringKeysLength16To31Id;
+  static final int stringKeysLength32To63Id;
+  static final int stringKeysLength64AndOverId;
+
+  /**
+   * Instance used for region entry contexts that do not keep entry shape statistics.
+   */
+  @Immutable
+  public static final RegionEntryShapeStats DISABLED;
+
+  static {
+    String statName = "RegionEntryShapeStatistics";
+    String statDescription =
+        "Statistics about the region entry classes created for a region and why keys were not stored inline";
+
+    StatisticsTypeFactory f = StatisticsTypeFactoryImpl.singleton();
+
+    type = f.createType(statName, statDescription, new StatisticDescriptor[] {
+        f.createLongCounter("objectKeyEntries",
+            "The number of entries created that hold a reference to their key object.",
+            "entries"),
+        f.createLongCounter("intKeyEntries",
+            "The number of entries created that store an Integer key inline.", "entries"),
+        f.createLongCounter("longKeyEntries",
+            "The number of entries created that store a Long key inline.", "entries"),
+        f.createLongCounter("uuidKeyEntries",
+            "The number of entries created that store a UUID key inline.", "entries"),
+        f.createLongCounter("stringKey1Entries",
+            "The number of entries created that store a String key inline in one long.",
+            "entries"),
+        f.createLongCounter("stringKey2Entries",
+            "The number of entries created that store a String key inline in two longs.",
+            "entries"),
+        f.createLongCounter("serializedKeyEntries",
+            "The number of off-heap entries created that store their serialized key off-heap.",
+            "entries"),
+        f.createLongCounter("inlineKeysDisabled",
+            "The number of entries whose key was not stored inline because inline region keys are disabled.",
+            "entries"),
+        f.createLongCounter("unsupportedKeyClass",
+            "The number of entries whose key was not stored inline because its class can not be inlined.",
+            "entries"),
+        f.createLongCounter("stringKeyTooLong",
+            "The number of entries whose String key was not stored inline because it is longer than the maximum inline length.",
+            "entries"),
+        f.createLongCounter("stringKeyNotByteEncodable",
+            "The number of entries whose String key was not stored inline because it contains non-ASCII characters and is too long to be stored inline as chars.",
+            "entries"),
+        f.createLongCounter("stringKeysLength0To3",
+            "The number of String keys with a length between 0 and 3 characters.", "keys"),
+        f.createLongCounter("stringKeysLength4To7",
+            "The number of String keys with a length between 4 and 7 characters.", "keys"),
+        f.createLongCounter("stringKeysLength8To15",
+            "The number of String keys with a length between 8 and 15 characters.", "keys"),
+        f.createLongCounter("stringKeysLength16To31",
+            "The number of String keys with a length between 16 and 31 characters.", "keys"),
+        f.createLongCounter("stringKeysLength32To63",
+            "The number of String keys with a length between 32 and 63 characters.", "keys"),
+        f.createLongCounter("stringKeysLength64AndOver",
+            "The number of String keys with a length of 64 characters or more.", "keys"),});
+
+    objectKeyEntriesId = type.nameToId("objectKeyEntries");
+    intKeyEntriesId = type.nameToId("intKeyEntries");
+    longKeyEntriesId = type.nameToId("longKeyEntries");
+    uuidKeyEntriesId = type.nameToId("uuidKeyEntries");
+    stringKey1EntriesId = type.nameToId("stringKey1Entries");
+    stringKey2EntriesId = type.nameToId("stringKey2Entries");
+    serializedKeyEntriesId = type.nameToId("serializedKeyEntries");
+
+    inlineKeysDisabledId = type.nameToId("inlineKeysDisabled");
+    unsupportedKeyClassId = type.nameToId("unsupportedKeyClass");
+    stringKeyTooLongId = type.nameToId("stringKeyTooLong");
+    stringKeyNotByteEncodableId = type.nameToId("stringKeyNotByteEncodable");
+
+    stringKeysLength0To3Id = type.nameToId("stringKeysLength0To3");
+    stringKeysLength4To7Id = type.nameToId("stringKeysLength4To7");
+    stringKeysLength8To15Id = type.nameToId("stringKeysLength8To15");
+    stringKeysLength16To31Id = type.nameToId("stringKeysLength16To31");
+    stringKeysLength32To63Id = type.nameToId("stringKeysLength32To63");
+    stringKeysLength64AndOverId = type.nameToId("stringKeysLength64AndOver");
+
+    DISABLED = new RegionEntryShapeStats(new DummyStatisticsImpl(type, "disabled", 0));
+  }
+
+  /** The Statistics object that we delegate most behavior to */
+  private final Statistics stats;
+
+  public RegionEntryShapeStats(StatisticsFactory factory, String textId) {
+    this(factory.createAtomicStatistics(type, textId));
+  }
+
+  private RegionEntryShapeStats(Statistics stats) {
+    this.stats = stats;
+  }
+
+  public static StatisticsType getStatisticsType() {
+    return type;
+  }
+
+  /**
+   * Returns the entry shape statistics of the given context, or {@link #DISABLED} if it does not
+   * keep any.
+   */
+  public static RegionEntryShapeStats of(RegionEntryContext context) {
+    if (context == null) {
+      return DISABLED;
+    }
+    RegionEntryShapeStats shapeStats = context.getEntryShapeStats();
+    return shapeStats == null ? DISABLED : shapeStats;
+  }
+
+  public void close() {
+    this.stats.close();
+  }
+
+  public void incObjectKeyEntries() {
+    this.stats.incLong(objectKeyEntriesId, 1);
+  }
+
+  public void incIntKeyEntries() {
+    this.stats.incLong(intKeyEntriesId, 1);
+  }
+
+  public void incLongKeyEntries() {
+    this.stats.incLong(longKeyEntriesId, 1);
+  }
+
+  public void incUUIDKeyEntries() {
+    this.stats.incLong(uuidKeyEntriesId, 1);
+  }
+
+  public void incStringKey1Entries() {
+    this.stats.incLong(stringKey1EntriesId, 1);
+  }
+
+  public void incStringKey2Entries() {
+    this.stats.incLong(stringKey2EntriesId, 1);
+  }
+
+  public void incSerializedKeyEntries() {
+    this.stats.incLong(serializedKeyEntriesId, 1);
+  }
+
+  public void incInlineKeysDisabled() {
+    this.stats.incLong(inlineKeysDisabledId, 1);
+  }
+
+  public void incUnsupportedKeyClass() {
+    this.stats.incLong(unsupportedKeyClassId, 1);
+  }
+
+  public void incStringKeyTooLong() {
+    this.stats.incLong(stringKeyTooLongId, 1);
+  }
+
+  public void incStringKeyNotByteEncodable() {
+    this.stats.incLong(stringKeyNotByteEncodableId, 1);
+  }
+
+  /**
+   * Adds a String key of the given length to the string key length distribution. The buckets line
+   * up with the inline string key limits of one and two longs.
+   */
+  public void recordStringKeyLength(int length) {
+    final int id;
+    if (length < 4) {
+      id = stringKeysLength0To3Id;
+    } else if (length < 8) {
+      id = stringKeysLength4To7Id;
+    } else if (length < 16) {
+      id = stringKeysLength8To15Id;
+    } else if (length < 32) {
+      id = stringKeysLength16To31Id;
+    } else if (length < 64) {
+      id = stringKeysLength32To63Id;
+    } else {
+      id = stringKeysLength64AndOverId;
+    }
+    this.stats.incLong(id, 1);
+  }
+
+  /**
+   * Returns the current value of every statistic, keyed by statistic name, in the order they are
+   * declared.
+   */
+  public Map<String, Long> getValues() {
+    Map<String, Long> values = new LinkedHashMap<>();
+    for (StatisticDescriptor descriptor : type.getStatistics()) {
+      values.put(descriptor.getName(), this.stats.getLong(descriptor));
+    }
+    return values;
+  }
+}
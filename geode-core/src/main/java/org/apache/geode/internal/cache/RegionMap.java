@@ -368,6 +368,22 @@ public interface RegionMap extends EvictableMap {
 
   default void unlockRegionForAtomicTX(InternalRegion r) {}
 
+  /**
+   * Starts a bulk load of this map by the current thread, for the initial population of the region
+   * by GII or a snapshot import. Until the matching {@link #endBulkLoad()}, the entries the thread
+   * creates with {@link #initialImagePut} and with puts are added to the region size, the eviction
+   * list and the entry count in batches instead of one at a time. Entries created by other threads
+   * are counted as usual.
+   */
+  default void beginBulkLoad() {}
+
+  /**
+   * Ends a bulk load started by {@link #beginBulkLoad()} on the current thread. Bulk loads of
+   * several threads may overlap; once the last of them ends, the entries they created have all been
+   * added to the region size, eviction list and entry count.
+   */
+  default void endBulkLoad() {}
+
   ARMLockTestHook getARMLockTestHook();
 
   long getEvictions();
@@ -0,0 +1,187 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache;
+
+import java.util.ArrayList;
+import java.util.IdentityHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+
+import org.apache.geode.util.internal.GeodeGlossary;
+
+/**
+ * Collects the bookkeeping of the entries created while a region map is bulk loaded. Instead of
+ * appending each new entry to the eviction list, running the LRU callback and updating the entry
+ * count and the region size one entry at a time, the entries are collected here and applied in
+ * batches of {@link #BATCH_SIZE}.
+ *
+ * <p>
+ * Only the entries created by the threads that began the bulk load are collected. They are already
+ * in the region map, so other threads can read, update and destroy them while they wait for their
+ * batch. Those operations call {@link #countEntry(RegionEntry)} first, which counts a waiting entry
+ * on its own so that the sizes they subtract from already include it.
+ *
+ * @see AbstractRegionMap#beginBulkLoad()
+ */
+public class RegionMapBulkLoad {
+
+  static final int BATCH_SIZE =
+      Integer.getInteger(GeodeGlossary.GEMFIRE_PREFIX + "BULK_LOAD_BATCH_SIZE", 1000);
+
+  private final AbstractRegionMap map;
+
+  /** The threads loading the map, with the number of bulk loads each of them has begun */
+  private final Map<Thread, Integer> loaders = new ConcurrentHashMap<>();
+
+  /** The entries waiting for their batch, in the order they were created */
+  private List<RegionEntry> createdEntries = new ArrayList<>();
+
+  /** The entries of createdEntries that have not been counted on their own yet */
+  private Map<RegionEntry, PendingEntry> pendingEntries = new IdentityHashMap<>();
+
+  /** The change in the size of the LRU from the entries in pendingEntries */
+  private int lruDelta;
+
+  /** The sum of the region sizes of the entries in pendingEntries */
+  private long createdSize;
+
+  RegionMapBulkLoad(AbstractRegionMap map) {
+    this.map = map;
+  }
+
+  /**
+   * Makes the current thread a loader of the map.
+   */
+  void join() {
+    loaders.merge(Thread.currentThread(), 1, Integer::sum);
+  }
+
+  /**
+   * Ends a bulk load of the current thread.
+   *
+   * @return true if no thread is loading the map anymore
+   */
+  boolean leave() {
+    loaders.computeIfPresent(Thread.currentThread(),
+        (thread, loads) -> loads > 1 ? loads - 1 : null);
+    return loaders.isEmpty();
+  }
+
+  /**
+   * Returns true if the current thread is loading the map.
+   */
+  boolean isLoader() {
+    return loaders.containsKey(Thread.currentThread());
+  }
+
+  /**
+   * Records an entry created by the bulk load. Must be called while holding the lock of the entry.
+   *
+   * @param size the size of the entry as given to
+   *        {@link InternalRegion#updateSizeOnCreate(Object, int)}
+   * @return true if the caller should {@link #flush()} once it no longer holds any entry lock
+   */
+  public boolean entryCreated(RegionEntry re, int size) {
+    final int lruDelta = map.lruBulkLoadEntryCreate(re);
+    synchronized (this) {
+      createdEntries.add(re);
+      pendingEntries.put(re, new PendingEntry(size, lruDelta));
+      this.lruDelta += lruDelta;
+      createdSize += size;
+      return createdEntries.size() >= BATCH_SIZE;
+    }
+  }
+
+  /**
+   * Counts the given entry right away if it is waiting for its batch. Must be called while holding
+   * the lock of the entry, before changing its size or removing it.
+   */
+  public void countEntry(RegionEntry re) {
+    final PendingEntry pending;
+    synchronized (this) {
+      pending = pendingEntries.remove(re);
+      if (pending == null) {
+        return;
+      }
+      lruDelta -= pending.lruDelta;
+      createdSize -= pending.size;
+    }
+    map._getOwner().updateSizeOnBulkCreate(1, pending.size);
+    map.lruBulkLoadEntryCount(re, pending.lruDelta);
+    map.incEntryCount(1);
+  }
+
+  /**
+   * Adds the entries recorded so far to the region size, the eviction list and the entry count.
+   * Must be called without holding any entry lock since it may evict.
+   */
+  public void flush() {
+    final List<RegionEntry> entries;
+    final Map<RegionEntry, PendingEntry> pending;
+    final int delta;
+    synchronized (this) {
+      if (createdEntries.isEmpty()) {
+        return;
+      }
+      entries = createdEntries;
+      pending = pendingEntries;
+      delta = lruDelta;
+      if (!pending.isEmpty()) {
+        // the entries are counted before they can no longer be found by countEntry
+        map._getOwner().updateSizeOnBulkCreate(pending.size(), createdSize);
+        map.lruBulkLoadEntriesCount(delta);
+        map.incEntryCount(pending.size());
+      }
+      createdEntries = new ArrayList<>(BATCH_SIZE);
+      pendingEntries = new IdentityHashMap<>(BATCH_SIZE);
+      lruDelta = 0;
+      createdSize = 0;
+    }
+    if (pending.size() < entries.size()) {
+      // the others were counted and appended to the eviction list on their own
+      entries.removeIf(re -> !pending.containsKey(re));
+    }
+    map.lruBulkLoadEntriesAppend(entries, delta);
+  }
+
+  /**
+   * Forgets the entries recorded so far because the region map is being cleared. They are still
+   * added to the region size and the entry count, so that the clear can uncount them, but not to
+   * the eviction list.
+   */
+  void discard() {
+    synchronized (this) {
+      if (!pendingEntries.isEmpty()) {
+        map._getOwner().updateSizeOnBulkCreate(pendingEntries.size(), createdSize);
+        map.incEntryCount(pendingEntries.size());
+      }
+      createdEntries = new ArrayList<>();
+      pendingEntries = new IdentityHashMap<>();
+      lruDelta = 0;
+      createdSize = 0;
+    }
+  }
+
+  private static class PendingEntry {
+    private final int size;
+    private final int lruDelta;
+
+    PendingEntry(int size, int lruDelta) {
+      this.size = size;
+      this.lruDelta = lruDelta;
+    }
+  }
+}
@@ -34,6 +34,8 @@ class RegionPerfStats extends CachePerfStats implements RegionStats {
   private final Gauge entriesGauge;
   private final Timer cacheGetsHitTimer;
   private final Timer cacheGetsMissTimer;
+  private final RegionEntryShapeStats entryShapeStats;
+  private final HotKeySketch hotKeySketch;
 
   RegionPerfStats(StatisticsFactory statisticsFactory, String textId, CachePerfStats cachePerfStats,
       InternalRegion region, MeterRegistry meterRegistry, StatisticsClock clock) {
@@ -64,10 +66,29 @@ class RegionPerfStats extends CachePerfStats implements RegionStats {
     this.cacheGetsMissTimer = cacheGetsMissTimer;
 
     stats.setLongSupplier(entryCountId, region::getLocalSize);
+    entryShapeStats = new RegionEntryShapeStats(statisticsFactory,
+        "RegionEntryShapeStats-" + region.getFullPath());
+    hotKeySketch = HotKeySketch.createIfEnabled(statisticsFactory,
+        "HotKeyStats-" + region.getFullPath());
+  }
+
+  @Override
+  public RegionEntryShapeStats getEntryShapeStats() {
+    return entryShapeStats;
+  }
+
+  @Override
+  public HotKeySketch getHotKeySketch() {
+    return hotKeySketch;
   }
 
   @Override
   protected void close() {
+    entryShapeStats.close();
+    if (hotKeySketch != null) {
+      hotKeySketch.close();
+    }
+
     meterRegistry.remove(entriesGauge);
     entriesGauge.close();
 
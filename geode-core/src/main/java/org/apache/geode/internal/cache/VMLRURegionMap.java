@@ -14,6 +14,7 @@
  */
 package org.apache.geode.internal.cache;
 
+import java.util.ArrayList;
 import java.util.Iterator;
 import java.util.List;
 import java.util.Set;
@@ -22,6 +23,7 @@ import org.apache.logging.log4j.Logger;
 
 import org.apache.geode.InternalGemFireException;
 import org.apache.geode.cache.EvictionAction;
+import org.apache.geode.cache.EvictionAlgorithm;
 import org.apache.geode.cache.RegionDestroyedException;
 import org.apache.geode.internal.Assert;
 import org.apache.geode.internal.cache.control.InternalResourceManager;
@@ -59,8 +61,8 @@ public class VMLRURegionMap extends AbstractRegionMap {
   public VMLRURegionMap(EvictableRegion owner, Attributes attr,
       InternalRegionArguments internalRegionArgs, EvictionController evictionController) {
     super(internalRegionArgs);
-    initialize(owner, attr, internalRegionArgs);
     this.evictionController = evictionController;
+    initialize(owner, attr, internalRegionArgs);
     getEvictionController().setPerEntryOverhead(getEntryOverhead());
     this.lruList = new EvictionListBuilder(getEvictionController()).create();
   }
@@ -81,13 +83,24 @@ public class VMLRURegionMap extends AbstractRegionMap {
 
   protected void initialize(EvictableRegion evictableRegion, Attributes attr,
       InternalRegionArguments internalRegionArgs) {
+    boolean isEntryCountLRU = isEntryCountLRU();
     if (evictableRegion instanceof InternalRegion) {
-      initialize((InternalRegion) evictableRegion, attr, internalRegionArgs, true);
+      initialize((InternalRegion) evictableRegion, attr, internalRegionArgs, true, isEntryCountLRU);
     } else {
-      initialize((PlaceHolderDiskRegion) evictableRegion, attr, internalRegionArgs, true);
+      initialize((PlaceHolderDiskRegion) evictableRegion, attr, internalRegionArgs, true,
+          isEntryCountLRU);
     }
   }
 
+  /**
+   * Entry count eviction only ever sizes an entry as 0 or 1 so its entries do not need a size
+   * field.
+   */
+  private boolean isEntryCountLRU() {
+    EvictionAlgorithm algorithm = getEvictionController().getEvictionAlgorithm();
+    return algorithm != null && algorithm.isLRUEntry();
+  }
+
   @Override
   public void setEntryFactory(RegionEntryFactory f) {
     super.setEntryFactory(f);
@@ -364,14 +377,25 @@ public class VMLRURegionMap extends AbstractRegionMap {
 
   @Override
   public void lruUpdateCallback() {
-    final boolean isDebugEnabled_LRU = logger.isTraceEnabled(LogMarker.LRU_VERBOSE);
-
     if (getCallbackDisabled()) {
       return;
     }
     final int delta = getDelta();
-    int bytesToEvict = delta;
     resetThreadLocals();
+    lruUpdateCallback(delta, false);
+  }
+
+  /**
+   * Evicts entries as needed for a change of delta in the total entry size.
+   *
+   * @param deltaCounted true if delta has already been added to the total entry size
+   */
+  private void lruUpdateCallback(final int delta, final boolean deltaCounted) {
+    final boolean isDebugEnabled_LRU = logger.isTraceEnabled(LogMarker.LRU_VERBOSE);
+
+    int bytesToEvict = delta;
+    // the part of the delta the total entry size does not include yet
+    final int uncountedDelta = deltaCounted ? 0 : delta;
     if (isDebugEnabled_LRU && _isOwnerALocalRegion()) {
       logger.trace(LogMarker.LRU_VERBOSE,
           "lruUpdateCallback; list size is: {}; actual size is: {}; map size is: {}; delta is: {}; limit is: {}; tombstone count={}",
@@ -380,10 +404,10 @@ public class VMLRURegionMap extends AbstractRegionMap {
     }
     EvictionCounters stats = getEvictionList().getStatistics();
     if (!_isOwnerALocalRegion()) {
-      changeTotalEntrySize(delta);
+      changeTotalEntrySize(uncountedDelta);
       // instead of evicting we just quit faulting values in
     } else if (getEvictionController().getEvictionAlgorithm().isLRUHeap()) {
-      changeTotalEntrySize(delta);
+      changeTotalEntrySize(uncountedDelta);
       try {
         while (bytesToEvict > 0
             && getEvictionController().mustEvict(stats, _getOwner(), bytesToEvict)) {
@@ -465,8 +489,8 @@ public class VMLRURegionMap extends AbstractRegionMap {
     } else {
       try {
         // to fix bug 48285 do no evict if bytesToEvict <= 0.
-        while (bytesToEvict > 0
-            && getEvictionController().mustEvict(stats, _getOwner(), bytesToEvict)) {
+        while (bytesToEvict > 0 && getEvictionController().mustEvict(stats, _getOwner(),
+            bytesToEvict - delta + uncountedDelta)) {
           EvictableEntry removalEntry = (EvictableEntry) getEvictionList().getEvictableEntry();
           if (removalEntry != null) {
             if (evictEntry(removalEntry, stats) != 0) {
@@ -494,7 +518,7 @@ public class VMLRURegionMap extends AbstractRegionMap {
             break;
           }
         }
-        changeTotalEntrySize(delta);
+        changeTotalEntrySize(uncountedDelta);
       } catch (RegionClearedException e) {
         if (isDebugEnabled_LRU) {
           logger.debug("exception ={}", e.getCause().getMessage(), e.getCause());
@@ -671,6 +695,44 @@ public class VMLRURegionMap extends AbstractRegionMap {
     }
   }
 
+  @Override
+  int lruBulkLoadEntryCreate(RegionEntry re) {
+    EvictableEntry e = (EvictableEntry) re;
+    e.unsetEvicted();
+    return e.updateEntrySize(getEvictionController());
+  }
+
+  @Override
+  void lruBulkLoadEntryCount(RegionEntry re, int lruDelta) {
+    changeTotalEntrySize(lruDelta);
+    if (!re.isDestroyedOrRemoved()) {
+      getEvictionList().appendEntry((EvictableEntry) re);
+    }
+  }
+
+  @Override
+  void lruBulkLoadEntriesCount(int lruDelta) {
+    changeTotalEntrySize(lruDelta);
+  }
+
+  @Override
+  void lruBulkLoadEntriesAppend(List<RegionEntry> entries, int lruDelta) {
+    DiskRegion disk = _getOwner().getDiskRegion();
+    boolean possibleClear = disk != null && disk.didClearCountChange();
+    List<EvictableEntry> evictableEntries = new ArrayList<>(entries.size());
+    for (RegionEntry re : entries) {
+      // skip entries that were destroyed or cleared while waiting for their batch
+      if (!re.isDestroyedOrRemoved()
+          && (!possibleClear || this._getOwner().basicGetEntry(re.getKey()) == re)) {
+        evictableEntries.add((EvictableEntry) re);
+      }
+    }
+    getEvictionList().appendEntries(evictableEntries);
+    if (!getCallbackDisabled()) {
+      lruUpdateCallback(lruDelta, true);
+    }
+  }
+
   @Override
   public void lruEntryUpdate(RegionEntry re) {
     final EvictableEntry e = (EvictableEntry) re;
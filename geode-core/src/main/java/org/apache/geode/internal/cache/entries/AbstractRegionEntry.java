@@ -115,6 +115,9 @@ public abstract class AbstractRegionEntry implements HashRegionEntry<Object, Obj
 
   private static final long UPDATE_IN_PROGRESS = 0x02L << 56;
 
+  /** used for LRUEntry instances sized by entry count. Set if the entry counts toward the limit. */
+  protected static final long COUNT_LRU_SIZE = 0x04L << 56;
+
   private static final long LISTENER_INVOCATION_IN_PROGRESS = 0x08L << 56;
 
   /** used for LRUEntry instances. */
@@ -129,6 +132,9 @@ public abstract class AbstractRegionEntry implements HashRegionEntry<Object, Obj
    */
   private static final long IN_USE_BY_TX = 0x40L << 56;
 
+  /** Set while the entry is in the expiration timer wheel of its region. */
+  private static final long EXPIRY_SCHEDULED = 0x80L << 56;
+
   protected AbstractRegionEntry(RegionEntryContext context,
       @Retained(ABSTRACT_REGION_ENTRY_PREPARE_VALUE_FOR_CACHE) Object value) {
 
@@ -1046,6 +1052,23 @@ public abstract class AbstractRegionEntry implements HashRegionEntry<Object, Obj
     } while (!done);
   }
 
+  /**
+   * Any bits in "bitMask" that are 1 will be set if "set" is true and cleared otherwise.
+   *
+   * @return true if this call changed any of the bits
+   */
+  protected boolean updateBits(long bitMask, boolean set) {
+    boolean done;
+    do {
+      long bits = getLastModifiedField();
+      long newBits = set ? bits | bitMask : bits & ~bitMask;
+      if (bits == newBits)
+        return false;
+      done = compareAndSetLastModifiedField(bits, newBits);
+    } while (!done);
+    return true;
+  }
+
   @Override
   @Retained(ABSTRACT_REGION_ENTRY_PREPARE_VALUE_FOR_CACHE)
   public Object prepareValueForCache(RegionEntryContext r,
@@ -1187,6 +1210,22 @@ public abstract class AbstractRegionEntry implements HashRegionEntry<Object, Obj
     return areAnyBitsSet(IN_USE_BY_TX);
   }
 
+  /**
+   * Returns true if the entry is in the expiration timer wheel of its region.
+   */
+  public boolean isExpiryScheduled() {
+    return areAnyBitsSet(EXPIRY_SCHEDULED);
+  }
+
+  /**
+   * Marks the entry as being in, or no longer in, the expiration timer wheel of its region.
+   *
+   * @return true if this call changed the mark
+   */
+  public boolean setExpiryScheduled(boolean scheduled) {
+    return updateBits(EXPIRY_SCHEDULED, scheduled);
+  }
+
   private void setInUseByTransaction(final boolean v) {
     if (v) {
       setBits(IN_USE_BY_TX);
@@ -38,6 +38,7 @@ import org.apache.geode.internal.cache.EntryEventImpl;
 import org.apache.geode.internal.cache.InitialImageOperation;
 import org.apache.geode.internal.cache.InternalCache;
 import org.apache.geode.internal.cache.InternalRegion;
+import org.apache.geode.internal.cache.OverflowWriter;
 import org.apache.geode.internal.cache.PlaceHolderDiskRegion;
 import org.apache.geode.internal.cache.RegionClearedException;
 import org.apache.geode.internal.cache.RegionEntry;
@@ -1085,7 +1086,9 @@ public interface DiskEntry extends RegionEntry {
       boolean lruFaultedIn = false;
       boolean done = false;
       try {
-        if (entry instanceof EvictableEntry && !dr.isSync()) {
+        // sync overflow only regions have pending writes when they use an overflow writer
+        if (entry instanceof EvictableEntry && (!dr.isSync()
+            || !dr.isBackup() && dr.getDiskStore().getOverflowWriter() != null)) {
           synchronized (entry) {
             DiskId did = entry.getDiskId();
             if (did != null && did.isPendingAsync()) {
@@ -1354,6 +1357,11 @@ public interface DiskEntry extends RegionEntry {
         did = entry.getDiskId();
       }
 
+      // Overflow only regions that write synchronously hand the value to the overflow writer
+      // of the disk store, if it has one, the same way async regions schedule it.
+      final OverflowWriter overflowWriter =
+          dr.isSync() && !dr.isBackup() ? dr.getDiskStore().getOverflowWriter() : null;
+
       int change = 0;
       boolean scheduledAsyncHere = false;
       dr.acquireReadLock();
@@ -1367,7 +1375,7 @@ public interface DiskEntry extends RegionEntry {
           // TODO: Check if we need to overflow even when id is = 0
           boolean wasAlreadyPendingAsync = did.isPendingAsync();
           if (did.needsToBeWritten()) {
-            if (doSynchronousWrite(region, dr)) {
+            if (overflowWriter == null && doSynchronousWrite(region, dr)) {
               writeToDisk(entry, region, false);
             } else if (!wasAlreadyPendingAsync) {
               scheduledAsyncHere = true;
@@ -1402,7 +1410,12 @@ public interface DiskEntry extends RegionEntry {
         // the version tag is null here because this method only needs
         // to write to disk for overflow only regions, which do not need
         // to maintain an RVV on disk.
-        scheduleAsyncWrite(new AsyncDiskEntry(region, entry, null));
+        AsyncDiskEntry ade = new AsyncDiskEntry(region, entry, null);
+        if (overflowWriter == null) {
+          scheduleAsyncWrite(ade);
+        } else if (!overflowWriter.schedule(ade)) {
+          handleFullAsyncQueue(entry, region, null);
+        }
       }
       return change;
     }
@@ -1486,7 +1499,7 @@ public interface DiskEntry extends RegionEntry {
                     // no need to write invalid or tombstones to disk if overflow only
                   } else if (entryVal != null) {
                     writeToDisk(entry, region, true);
-                    assert !dr.isSync();
+                    assert !dr.isSync() || !dr.isBackup();
                     // Only setValue to null if this was an evict.
                     // We could just be a backup that is writing async.
                     if (!Token.isInvalid(entryVal) && (entryVal != Token.TOMBSTONE)
@@ -15,7 +15,7 @@
 package org.apache.geode.internal.cache.entries;
 
 // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
-#if defined(KEY_OBJECT)
+#if defined(KEY_OBJECT) || defined(KEY_SERIALIZED)
 #define KEY_TYPE Object
 #elif defined(KEY_INT)
 #define KEY_TYPE int
@@ -28,6 +28,9 @@ package org.apache.geode.internal.cache.entries;
 #else
 #error the KEY_TYPE macro must be defined    
 #endif
+#if defined(KEY_SERIALIZED) && !defined(OFFHEAP)
+#error serialized keys are only stored off-heap
+#endif
 
 #ifdef KEY_UUID
 import java.util.UUID;
@@ -78,6 +81,7 @@ import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap.Ha
  *
  * disk: DISK
  * lru: LRU
+ * count lru: COUNT_LRU
  * stats: STATS
  * versioned: VERSIONED
  * offheap: OFFHEAP
@@ -90,13 +94,18 @@ import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap.Ha
  * key uuid: KEY_UUID
  * key string1: KEY_STRING1
  * key string2: KEY_STRING2
+ * key serialized: KEY_SERIALIZED (requires OFFHEAP)
  */
 
 /**
  * Do not modify this class. It was generated. Instead modify LeafRegionEntry.cpp and then run
  * ./dev-tools/generateRegionEntryClasses.sh (it must be run from the top level directory).
  */
+#ifdef KEY_SERIALIZED
+public class LEAF_CLASS extends PARENT_CLASS implements SerializedKeyRegionEntry {
+#else
 public class LEAF_CLASS extends PARENT_CLASS {
+#endif
 
   // --------------------------------------- common fields ----------------------------------------
 
@@ -199,6 +208,23 @@ public class LEAF_CLASS extends PARENT_CLASS {
    * bits2 encodes character data
    */
   private final long bits2;
+#elif defined(KEY_SERIALIZED)
+  /**
+   * The key while it is not stored off-heap, which is before the entry is added to the map, after
+   * it lost the race to be added and if the key can not be serialized. Null while the key is stored
+   * off-heap and once it is released because the entry was removed from the map.
+   */
+  private volatile Object heapKey;
+
+  /**
+   * The address of the serialized key, or zero while the key is on the heap. All access done using
+   * OFF_HEAP_KEY_ADDRESS_UPDATER.
+   */
+  @SuppressWarnings("unused")
+  @Retained @Released private volatile long offHeapKeyAddress;
+
+  private static final AtomicLongFieldUpdater<LEAF_CLASS> OFF_HEAP_KEY_ADDRESS_UPDATER =
+      AtomicLongFieldUpdater.newUpdater(LEAF_CLASS.class, "offHeapKeyAddress");
 #endif
 
   public LEAF_CLASS (final RegionEntryContext context, final KEY_TYPE key,
@@ -223,6 +249,9 @@ public class LEAF_CLASS extends PARENT_CLASS {
 #endif
 #if defined(KEY_OBJECT)
     this.key = key;
+#elif defined(KEY_SERIALIZED)
+    // the map moves the key off-heap when this entry is added to it
+    this.heapKey = key;
 #elif defined(KEY_INT)
     this.key = key;
 #elif defined(KEY_LONG)
@@ -400,6 +429,12 @@ public class LEAF_CLASS extends PARENT_CLASS {
     }
   }
 
+#ifdef COUNT_LRU
+  @Override
+  public int updateAsyncEntrySize(final EvictionController evictionController) {
+    return setEntrySize(evictionController.entrySize(getKeyForSizing(), null));
+  }
+#else
   @Override
   public synchronized int updateAsyncEntrySize(final EvictionController evictionController) {
     int oldSize = getEntrySize();
@@ -408,6 +443,7 @@ public class LEAF_CLASS extends PARENT_CLASS {
     int delta = newSize - oldSize;
     return delta;
   }
+#endif
 #else
   protected void initialize(final RegionEntryContext context, final Object value) {
     diskInitialize(context, value);
@@ -456,6 +492,20 @@ public class LEAF_CLASS extends PARENT_CLASS {
 #endif
   }
 
+#ifdef COUNT_LRU
+  @Override
+  public int updateEntrySize(final EvictionController evictionController) {
+    // entry count eviction only looks at the token so the value is never read
+    return updateEntrySize(evictionController, getValueAsToken());
+  }
+
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+
+  @Override
+  public int updateEntrySize(final EvictionController evictionController, final Object value) {
+    return setEntrySize(evictionController.entrySize(getKeyForSizing(), value));
+  }
+#else
   @Override
   public synchronized int updateEntrySize(final EvictionController evictionController) {
     // OFFHEAP: getValue ok w/o incing refcount because we are synced and only getting the size
@@ -472,6 +522,7 @@ public class LEAF_CLASS extends PARENT_CLASS {
     int delta = newSize - oldSize;
     return delta;
   }
+#endif
 
   @Override
   public boolean isRecentlyUsed() {
@@ -510,7 +561,9 @@ public class LEAF_CLASS extends PARENT_CLASS {
 
   private EvictionNode nextEvictionNode;
   private EvictionNode previousEvictionNode;
+#ifndef COUNT_LRU
   private int size;
+#endif
 
   @Override
   public void setNext(final EvictionNode nextEvictionNode) {
@@ -532,6 +585,24 @@ public class LEAF_CLASS extends PARENT_CLASS {
     return this.previousEvictionNode;
   }
 
+#ifdef COUNT_LRU
+  @Override
+  public int getEntrySize() {
+    return areAnyBitsSet(COUNT_LRU_SIZE) ? 1 : 0;
+  }
+
+  /**
+   * Entry count eviction sizes an entry as 0 or 1 so the size is kept in a state bit instead of a
+   * field. Returns the change in size.
+   */
+  private int setEntrySize(final int size) {
+    boolean counted = size != 0;
+    if (!updateBits(COUNT_LRU_SIZE, counted)) {
+      return 0;
+    }
+    return counted ? 1 : -1;
+  }
+#else
   @Override
   public int getEntrySize() {
     return this.size;
@@ -540,6 +611,7 @@ public class LEAF_CLASS extends PARENT_CLASS {
   protected void setEntrySize(final int size) {
     this.size = size;
   }
+#endif
 
   // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
   
@@ -548,6 +620,9 @@ public class LEAF_CLASS extends PARENT_CLASS {
 #ifdef KEY_OBJECT
     // default implementation.
     return getKey();
+#elif defined(KEY_SERIALIZED)
+    // the key is stored off-heap so it does not add to the heap size of the entry
+    return null;
 #else
     // inline keys always report null for sizing since the size comes from the entry size
     return null;
@@ -741,6 +816,37 @@ public class LEAF_CLASS extends PARENT_CLASS {
     return this.key;
   }
 
+#elif defined(KEY_SERIALIZED)
+  @Override
+  public Object getKey() {
+    return OffHeapRegionEntryHelper.getKey(this);
+  }
+
+  @Override
+  public boolean isKeyEqual(final Object key) {
+    return OffHeapRegionEntryHelper.isKeyEqual(this, key);
+  }
+
+  @Override
+  public Object getHeapKey() {
+    return this.heapKey;
+  }
+
+  @Override
+  public void setHeapKey(final Object key) {
+    this.heapKey = key;
+  }
+
+  @Override
+  public long getKeyAddress() {
+    return OFF_HEAP_KEY_ADDRESS_UPDATER.get(this);
+  }
+
+  @Override
+  public boolean setKeyAddress(final long expectedAddress, final long newAddress) {
+    return OFF_HEAP_KEY_ADDRESS_UPDATER.compareAndSet(this, expectedAddress, newAddress);
+  }
+
 #elif defined(KEY_INT)
   @Override
   public Object getKey() {
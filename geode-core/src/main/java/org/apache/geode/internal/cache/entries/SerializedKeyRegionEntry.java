@@ -0,0 +1,45 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache.entries;
+
+import org.apache.geode.internal.offheap.OffHeapRegionEntryHelper;
+
+/**
+ * An off-heap RegionEntry that stores the serialized form of its key off-heap, next to its value,
+ * while it is in a region map. Only the hash of the key and the address of the serialized key are
+ * kept on the heap. The key is moved off-heap when the entry is added to the map and back onto the
+ * heap when the entry is removed.
+ *
+ * @see OffHeapRegionEntryHelper#storeKeyOffHeap(SerializedKeyRegionEntry)
+ */
+public interface SerializedKeyRegionEntry extends OffHeapRegionEntry {
+
+  /**
+   * Returns the key if it is on the heap, or null if it is stored off-heap.
+   */
+  Object getHeapKey();
+
+  void setHeapKey(Object key);
+
+  /**
+   * OFF_HEAP_KEY_FIELD_READER
+   */
+  long getKeyAddress();
+
+  /**
+   * OFF_HEAP_KEY_FIELD_WRITER
+   */
+  boolean setKeyAddress(long expectedAddress, long newAddress);
+}
@@ -0,0 +1,363 @@
+
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache.entries;
+
+// DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+import java.util.concurrent.atomic.AtomicIntegerFieldUpdater;
+import java.util.concurrent.atomic.AtomicLongFieldUpdater;
+
+import org.apache.geode.internal.InternalStatisticsDisabledException;
+import org.apache.geode.internal.cache.RegionEntryContext;
+import org.apache.geode.internal.cache.eviction.EvictionController;
+import org.apache.geode.internal.cache.eviction.EvictionNode;
+import org.apache.geode.internal.cache.persistence.DiskRecoveryStore;
+import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap.HashEntry;
+
+/*
+ * macros whose definition changes this class:
+ *
+ * disk: DISK lru: LRU count lru: COUNT_LRU stats: STATS versioned: VERSIONED offheap: OFFHEAP
+ *
+ * One of the following key macros must be defined:
+ *
+ * key object: KEY_OBJECT key int: KEY_INT key long: KEY_LONG key uuid: KEY_UUID key string1:
+ * KEY_STRING1 key string2: KEY_STRING2 key serialized: KEY_SERIALIZED (requires OFFHEAP)
+ */
+/**
+ * Do not modify this class. It was generated. Instead modify LeafRegionEntry.cpp and then run
+ * ./dev-tools/generateRegionEntryClasses.sh (it must be run from the top level directory).
+ */
+public class VMStatsCountLRURegionEntryHeapStringKey1 extends VMStatsCountLRURegionEntryHeap {
+  // --------------------------------------- common fields ----------------------------------------
+  private static final AtomicLongFieldUpdater<VMStatsCountLRURegionEntryHeapStringKey1> LAST_MODIFIED_UPDATER =
+      AtomicLongFieldUpdater.newUpdater(VMStatsCountLRURegionEntryHeapStringKey1.class,
+          "lastModified");
+  protected int hash;
+  private HashEntry<Object, Object> nextEntry;
+  @SuppressWarnings("unused")
+  private volatile long lastModified;
+  private volatile Object value;
+  // --------------------------------------- stats fields -----------------------------------------
+  private volatile long lastAccessed;
+  private volatile int hitCount;
+  private volatile int missCount;
+  private static final AtomicIntegerFieldUpdater<VMStatsCountLRURegionEntryHeapStringKey1> HIT_COUNT_UPDATER =
+      AtomicIntegerFieldUpdater.newUpdater(VMStatsCountLRURegionEntryHeapStringKey1.class,
+          "hitCount");
+  private static final AtomicIntegerFieldUpdater<VMStatsCountLRURegionEntryHeapStringKey1> MISS_COUNT_UPDATER =
+      AtomicIntegerFieldUpdater.newUpdater(VMStatsCountLRURegionEntryHeapStringKey1.class,
+          "missCount");
+  // --------------------------------------- key fields -------------------------------------------
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+  private final long bits1;
+
+  public VMStatsCountLRURegionEntryHeapStringKey1(final RegionEntryContext context,
+      final String key, final Object value, final boolean byteEncode) {
+    super(context, value);
+    // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+    // caller has already confirmed that key.length <= MAX_INLINE_STRING_KEY
+    long tempBits1 = 0L;
+    if (byteEncode) {
+      for (int i = key.length() - 1; i >= 0; i--) {
+        // Note: we know each byte is <= 0x7f so the "& 0xff" is not needed. But I added it in to
+        // keep findbugs happy.
+        tempBits1 |= (byte) key.charAt(i) & 0xff;
+        tempBits1 <<= 8;
+      }
+      tempBits1 |= 1 << 6;
+    } else {
+      for (int i = key.length() - 1; i >= 0; i--) {
+        tempBits1 |= key.charAt(i);
+        tempBits1 <<= 16;
+      }
+    }
+    tempBits1 |= key.length();
+    this.bits1 = tempBits1;
+  }
+
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+  @Override
+  protected Object getValueField() {
+    return this.value;
+  }
+
+  @Override
+  protected void setValueField(final Object value) {
+    this.value = value;
+  }
+
+  @Override
+  protected long getLastModifiedField() {
+    return LAST_MODIFIED_UPDATER.get(this);
+  }
+
+  @Override
+  protected boolean compareAndSetLastModifiedField(final long expectedValue, final long newValue) {
+    return LAST_MODIFIED_UPDATER.compareAndSet(this, expectedValue, newValue);
+  }
+
+  @Override
+  public int getEntryHash() {
+    return this.hash;
+  }
+
+  @Override
+  protected void setEntryHash(final int hash) {
+    this.hash = hash;
+  }
+
+  @Override
+  public HashEntry<Object, Object> getNextEntry() {
+    return this.nextEntry;
+  }
+
+  @Override
+  public void setNextEntry(final HashEntry<Object, Object> nextEntry) {
+    this.nextEntry = nextEntry;
+  }
+
+  // --------------------------------------- eviction code ----------------------------------------
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+  @Override
+  public void setDelayedDiskId(final DiskRecoveryStore diskRecoveryStore) {
+    // nothing needed for LRUs with no disk
+  }
+
+  @Override
+  public int updateEntrySize(final EvictionController evictionController) {
+    // entry count eviction only looks at the token so the value is never read
+    return updateEntrySize(evictionController, getValueAsToken());
+  }
+
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+  @Override
+  public int updateEntrySize(final EvictionController evictionController, final Object value) {
+    return setEntrySize(evictionController.entrySize(getKeyForSizing(), value));
+  }
+
+  @Override
+  public boolean isRecentlyUsed() {
+    return areAnyBitsSet(RECENTLY_USED);
+  }
+
+  @Override
+  public void setRecentlyUsed(RegionEntryContext context) {
+    if (!isRecentlyUsed()) {
+      setBits(RECENTLY_USED);
+      context.incRecentlyUsed();
+    }
+  }
+
+  @Override
+  public void unsetRecentlyUsed() {
+    clearBits(~RECENTLY_USED);
+  }
+
+  @Override
+  public boolean isEvicted() {
+    return areAnyBitsSet(EVICTED);
+  }
+
+  @Override
+  public void setEvicted() {
+    setBits(EVICTED);
+  }
+
+  @Override
+  public void unsetEvicted() {
+    clearBits(~EVICTED);
+  }
+
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+  private EvictionNode nextEvictionNode;
+  private EvictionNode previousEvictionNode;
+
+  @Override
+  public void setNext(final EvictionNode nextEvictionNode) {
+    this.nextEvictionNode = nextEvictionNode;
+  }
+
+  @Override
+  public EvictionNode next() {
+    return this.nextEvictionNode;
+  }
+
+  @Override
+  public void setPrevious(final EvictionNode previousEvictionNode) {
+    this.previousEvictionNode = previousEvictionNode;
+  }
+
+  @Override
+  public EvictionNode previous() {
+    return this.previousEvictionNode;
+  }
+
+  @Override
+  public int getEntrySize() {
+    return areAnyBitsSet(COUNT_LRU_SIZE) ? 1 : 0;
+  }
+
+  /**
+   * Entry count eviction sizes an entry as 0 or 1 so the size is kept in a state bit instead of a
+   * field. Returns the change in size.
+   */
+  private int setEntrySize(final int size) {
+    boolean counted = size != 0;
+    if (!updateBits(COUNT_LRU_SIZE, counted)) {
+      return 0;
+    }
+    return counted ? 1 : -1;
+  }
+
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+  @Override
+  public Object getKeyForSizing() {
+    // inline keys always report null for sizing since the size comes from the entry size
+    return null;
+  }
+
+  // ---------------------------------------- stats code ------------------------------------------
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+  @Override
+  public void updateStatsForGet(final boolean isHit, final long time) {
+    setLastAccessed(time);
+    if (isHit) {
+      incrementHitCount();
+    } else {
+      incrementMissCount();
+    }
+  }
+
+  @Override
+  protected void setLastModifiedAndAccessedTimes(final long lastModified, final long lastAccessed) {
+    _setLastModified(lastModified);
+    if (!DISABLE_ACCESS_TIME_UPDATE_ON_PUT) {
+      setLastAccessed(lastAccessed);
+    }
+  }
+
+  @Override
+  public long getLastAccessed() throws InternalStatisticsDisabledException {
+    return this.lastAccessed;
+  }
+
+  @Override
+  public void setLastAccessed(final long lastAccessed) {
+    this.lastAccessed = lastAccessed;
+  }
+
+  @Override
+  public long getHitCount() throws InternalStatisticsDisabledException {
+    return this.hitCount & 0xFFFFFFFFL;
+  }
+
+  @Override
+  public long getMissCount() throws InternalStatisticsDisabledException {
+    return this.missCount & 0xFFFFFFFFL;
+  }
+
+  private void incrementHitCount() {
+    HIT_COUNT_UPDATER.incrementAndGet(this);
+  }
+
+  private void incrementMissCount() {
+    MISS_COUNT_UPDATER.incrementAndGet(this);
+  }
+
+  @Override
+  public void resetCounts() throws InternalStatisticsDisabledException {
+    HIT_COUNT_UPDATER.set(this, 0);
+    MISS_COUNT_UPDATER.set(this, 0);
+  }
+
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+  @Override
+  public void txDidDestroy(long timeStamp) {
+    setLastModified(timeStamp);
+    setLastAccessed(timeStamp);
+    this.hitCount = 0;
+    this.missCount = 0;
+  }
+
+  @Override
+  public boolean hasStats() {
+    return true;
+  }
+
+  // ----------------------------------------- key code -------------------------------------------
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+  private int getKeyLength() {
+    return (int) (this.bits1 & 0x003fL);
+  }
+
+  private int getEncoding() {
+    // 0 means encoded as char
+    // 1 means encoded as bytes that are all <= 0x7f;
+    return (int) (this.bits1 >> 6) & 0x03;
+  }
+
+  @Override
+  public Object getKey() {
+    int keyLength = getKeyLength();
+    char[] chars = new char[keyLength];
+    long tempBits1 = this.bits1;
+    if (getEncoding() == 1) {
+      for (int i = 0; i < keyLength; i++) {
+        tempBits1 >>= 8;
+        chars[i] = (char) (tempBits1 & 0x00ff);
+      }
+    } else {
+      for (int i = 0; i < keyLength; i++) {
+        tempBits1 >>= 16;
+        chars[i] = (char) (tempBits1 & 0x00FFff);
+      }
+    }
+    return new String(chars);
+  }
+
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+  @Override
+  public boolean isKeyEqual(final Object key) {
+    if (key instanceof String) {
+      String stringKey = (String) key;
+      int keyLength = getKeyLength();
+      if (stringKey.length() == keyLength) {
+        long tempBits1 = this.bits1;
+        if (getEncoding() == 1) {
+          for (int i = 0; i < keyLength; i++) {
+            tempBits1 >>= 8;
+            char character = (char) (tempBits1 & 0x00ff);
+            if (stringKey.charAt(i) != character) {
+              return false;
+            }
+          }
+        } else {
+          for (int i = 0; i < keyLength; i++) {
+            tempBits1 >>= 16;
+            char character = (char) (tempBits1 & 0x00FFff);
+            if (stringKey.charAt(i) != character) {
+              return false;
+            }
+          }
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+  // DO NOT modify this class. It was generated from LeafRegionEntry.cpp
+}
@@ -0,0 +1,97 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache.entries;
+
+import java.util.UUID;
+
+import org.apache.geode.annotations.Immutable;
+import org.apache.geode.internal.cache.InlineKeyHelper;
+import org.apache.geode.internal.cache.RegionEntry;
+import org.apache.geode.internal.cache.RegionEntryContext;
+import org.apache.geode.internal.cache.RegionEntryFactory;
+import org.apache.geode.internal.cache.RegionEntryShapeStats;
+
+public abstract class VMStatsDiskCountLRURegionEntryHeap extends VMStatsDiskCountLRURegionEntry {
+
+  public VMStatsDiskCountLRURegionEntryHeap(RegionEntryContext context, Object value) {
+    super(context, value);
+  }
+
+  @Immutable
+  private static final VMStatsDiskCountLRURegionEntryHeapFactory factory =
+      new VMStatsDiskCountLRURegionEntryHeapFactory();
+
+  public static RegionEntryFactory getEntryFactory() {
+    return factory;
+  }
+
+  private static class VMStatsDiskCountLRURegionEntryHeapFactory implements RegionEntryFactory {
+    @Override
+    public RegionEntry createEntry(RegionEntryContext context, Object key, Object value) {
+      final RegionEntryShapeStats shapeStats = RegionEntryShapeStats.of(context);
+      if (InlineKeyHelper.INLINE_REGION_KEYS) {
+        Class<?> keyClass = key.getClass();
+        if (keyClass == Integer.class) {
+          shapeStats.incIntKeyEntries();
+          return new VMStatsDiskCountLRURegionEntryHeapIntKey(context, (Integer) key, value);
+        } else if (keyClass == Long.class) {
+          shapeStats.incLongKeyEntries();
+          return new VMStatsDiskCountLRURegionEntryHeapLongKey(context, (Long) key, value);
+        } else if (keyClass == String.class) {
+          final String skey = (String) key;
+          final Boolean info = InlineKeyHelper.canStringBeInlineEncoded(skey, shapeStats);
+          if (info != null) {
+            final boolean byteEncoded = info;
+            if (skey.length() <= InlineKeyHelper.getMaxInlineStringKey(1, byteEncoded)) {
+              shapeStats.incStringKey1Entries();
+              return new VMStatsDiskCountLRURegionEntryHeapStringKey1(context, skey, value,
+                  byteEncoded);
+            } else {
+              shapeStats.incStringKey2Entries();
+              return new VMStatsDiskCountLRURegionEntryHeapStringKey2(context, skey, value,
+                  byteEncoded);
+            }
+          }
+        } else if (keyClass == UUID.class) {
+          shapeStats.incUUIDKeyEntries();
+          return new VMStatsDiskCountLRURegionEntryHeapUUIDKey(context, (UUID) key, value);
+        } else {
+          shapeStats.incUnsupportedKeyClass();
+        }
+      } else {
+        shapeStats.incInlineKeysDisabled();
+      }
+      shapeStats.incObjectKeyEntries();
+      return new VMStatsDiskCountLRURegionEntryHeapObjectKey(context, key, value);
+    }
+
+    @Override
+    public Class getEntryClass() {
+      // The class returned from this method is used to estimate the memory size.
+      // This estimate will not take into account the memory saved by inlining the keys.
+      return VMStatsDiskCountLRURegionEntryHeapObjectKey.class;
+    }
+
+    @Override
+    public RegionEntryFactory makeVersioned() {
+      return VersionedStatsDiskCountLRURegionEntryHeap.getEntryFactory();
+    }
+
+    @Override
+    public RegionEntryFactory makeOnHeap() {
+      return this;
+    }
+  }
+}
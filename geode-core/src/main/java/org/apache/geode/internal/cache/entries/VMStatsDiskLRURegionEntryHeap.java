@@ -21,6 +21,7 @@ import org.apache.geode.internal.cache.InlineKeyHelper;
 import org.apache.geode.internal.cache.RegionEntry;
 import org.apache.geode.internal.cache.RegionEntryContext;
 import org.apache.geode.internal.cache.RegionEntryFactory;
+import org.apache.geode.internal.cache.RegionEntryShapeStats;
 
 public abstract class VMStatsDiskLRURegionEntryHeap extends VMStatsDiskLRURegionEntry {
 
@@ -39,27 +40,38 @@ public abstract class VMStatsDiskLRURegionEntryHeap extends VMStatsDiskLRURegion
   private static class VMStatsDiskLRURegionEntryHeapFactory implements RegionEntryFactory {
     @Override
     public RegionEntry createEntry(RegionEntryContext context, Object key, Object value) {
+      final RegionEntryShapeStats shapeStats = RegionEntryShapeStats.of(context);
       if (InlineKeyHelper.INLINE_REGION_KEYS) {
         Class<?> keyClass = key.getClass();
         if (keyClass == Integer.class) {
+          shapeStats.incIntKeyEntries();
           return new VMStatsDiskLRURegionEntryHeapIntKey(context, (Integer) key, value);
         } else if (keyClass == Long.class) {
+          shapeStats.incLongKeyEntries();
           return new VMStatsDiskLRURegionEntryHeapLongKey(context, (Long) key, value);
         } else if (keyClass == String.class) {
           final String skey = (String) key;
-          final Boolean info = InlineKeyHelper.canStringBeInlineEncoded(skey);
+          final Boolean info = InlineKeyHelper.canStringBeInlineEncoded(skey, shapeStats);
           if (info != null) {
             final boolean byteEncoded = info;
             if (skey.length() <= InlineKeyHelper.getMaxInlineStringKey(1, byteEncoded)) {
+              shapeStats.incStringKey1Entries();
               return new VMStatsDiskLRURegionEntryHeapStringKey1(context, skey, value, byteEncoded);
             } else {
+              shapeStats.incStringKey2Entries();
               return new VMStatsDiskLRURegionEntryHeapStringKey2(context, skey, value, byteEncoded);
             }
           }
         } else if (keyClass == UUID.class) {
+          shapeStats.incUUIDKeyEntries();
           return new VMStatsDiskLRURegionEntryHeapUUIDKey(context, (UUID) key, value);
+        } else {
+          shapeStats.incUnsupportedKeyClass();
         }
+      } else {
+        shapeStats.incInlineKeysDisabled();
       }
+      shapeStats.incObjectKeyEntries();
       return new VMStatsDiskLRURegionEntryHeapObjectKey(context, key, value);
     }
 
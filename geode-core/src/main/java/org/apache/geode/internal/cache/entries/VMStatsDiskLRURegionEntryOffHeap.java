@@ -21,6 +21,8 @@ import org.apache.geode.internal.cache.InlineKeyHelper;
 import org.apache.geode.internal.cache.RegionEntry;
 import org.apache.geode.internal.cache.RegionEntryContext;
 import org.apache.geode.internal.cache.RegionEntryFactory;
+import org.apache.geode.internal.cache.RegionEntryShapeStats;
+import org.apache.geode.internal.offheap.OffHeapRegionEntryHelper;
 
 public abstract class VMStatsDiskLRURegionEntryOffHeap extends VMStatsDiskLRURegionEntry
     implements OffHeapRegionEntry {
@@ -40,29 +42,44 @@ public abstract class VMStatsDiskLRURegionEntryOffHeap extends VMStatsDiskLRUReg
   private static class VMStatsDiskLRURegionEntryOffHeapFactory implements RegionEntryFactory {
     @Override
     public RegionEntry createEntry(RegionEntryContext context, Object key, Object value) {
+      final RegionEntryShapeStats shapeStats = RegionEntryShapeStats.of(context);
       if (InlineKeyHelper.INLINE_REGION_KEYS) {
         Class<?> keyClass = key.getClass();
         if (keyClass == Integer.class) {
+          shapeStats.incIntKeyEntries();
           return new VMStatsDiskLRURegionEntryOffHeapIntKey(context, (Integer) key, value);
         } else if (keyClass == Long.class) {
+          shapeStats.incLongKeyEntries();
           return new VMStatsDiskLRURegionEntryOffHeapLongKey(context, (Long) key, value);
         } else if (keyClass == String.class) {
           final String skey = (String) key;
-          final Boolean info = InlineKeyHelper.canStringBeInlineEncoded(skey);
+          final Boolean info = InlineKeyHelper.canStringBeInlineEncoded(skey, shapeStats);
           if (info != null) {
             final boolean byteEncoded = info;
             if (skey.length() <= InlineKeyHelper.getMaxInlineStringKey(1, byteEncoded)) {
+              shapeStats.incStringKey1Entries();
               return new VMStatsDiskLRURegionEntryOffHeapStringKey1(context, skey, value,
                   byteEncoded);
             } else {
+              shapeStats.incStringKey2Entries();
               return new VMStatsDiskLRURegionEntryOffHeapStringKey2(context, skey, value,
                   byteEncoded);
             }
           }
         } else if (keyClass == UUID.class) {
+          shapeStats.incUUIDKeyEntries();
           return new VMStatsDiskLRURegionEntryOffHeapUUIDKey(context, (UUID) key, value);
+        } else {
+          shapeStats.incUnsupportedKeyClass();
         }
+      } else {
+        shapeStats.incInlineKeysDisabled();
       }
+      if (OffHeapRegionEntryHelper.OFF_HEAP_REGION_KEYS) {
+        shapeStats.incSerializedKeyEntries();
+        return new VMStatsDiskLRURegionEntryOffHeapSerializedKey(context, key, value);
+      }
+      shapeStats.incObjectKeyEntries();
       return new VMStatsDiskLRURegionEntryOffHeapObjectKey(context, key, value);
     }
 
@@ -21,6 +21,8 @@ import org.apache.geode.internal.cache.InlineKeyHelper;
 import org.apache.geode.internal.cache.RegionEntry;
 import org.apache.geode.internal.cache.RegionEntryContext;
 import org.apache.geode.internal.cache.RegionEntryFactory;
+import org.apache.geode.internal.cache.RegionEntryShapeStats;
+import org.apache.geode.internal.offheap.OffHeapRegionEntryHelper;
 
 public abstract class VMStatsDiskRegionEntryOffHeap extends VMStatsDiskRegionEntry
     implements OffHeapRegionEntry {
@@ -40,27 +42,42 @@ public abstract class VMStatsDiskRegionEntryOffHeap extends VMStatsDiskRegionEnt
   private static class VMStatsDiskRegionEntryOffHeapFactory implements RegionEntryFactory {
     @Override
     public RegionEntry createEntry(RegionEntryContext context, Object key, Object value) {
+      final RegionEntryShapeStats shapeStats = RegionEntryShapeStats.of(context);
       if (InlineKeyHelper.INLINE_REGION_KEYS) {
         Class<?> keyClass = key.getClass();
         if (keyClass == Integer.class) {
+          shapeStats.incIntKeyEntries();
           return new VMStatsDiskRegionEntryOffHeapIntKey(context, (Integer) key, value);
         } else if (keyClass == Long.class) {
+          shapeStats.incLongKeyEntries();
           return new VMStatsDiskRegionEntryOffHeapLongKey(context, (Long) key, value);
         } else if (keyClass == String.class) {
           final String skey = (String) key;
-          final Boolean info = InlineKeyHelper.canStringBeInlineEncoded(skey);
+          final Boolean info = InlineKeyHelper.canStringBeInlineEncoded(skey, shapeStats);
           if (info != null) {
             final boolean byteEncoded = info;
             if (skey.length() <= InlineKeyHelper.getMaxInlineStringKey(1, byteEncoded)) {
+              shapeStats.incStringKey1Entries();
               return new VMStatsDiskRegionEntryOffHeapStringKey1(context, skey, value, byteEncoded);
             } else {
+              shapeStats.incStringKey2Entries();
               return new VMStatsDiskRegionEntryOffHeapStringKey2(context, skey, value, byteEncoded);
             }
           }
         } else if (keyClass == UUID.class) {
+          shapeStats.incUUIDKeyEntries();
           return new VMStatsDiskRegionEntryOffHeapUUIDKey(context, (UUID) key, value);
+        } else {
+          shapeStats.incUnsupportedKeyClass();
         }
+      } else {
+        shapeStats.incInlineKeysDisabled();
       }
+      if (OffHeapRegionEntryHelper.OFF_HEAP_REGION_KEYS) {
+        shapeStats.incSerializedKeyEntries();
+        return new VMStatsDiskRegionEntryOffHeapSerializedKey(context, key, value);
+      }
+      shapeStats.incObjectKeyEntries();
       return new VMStatsDiskRegionEntryOffHeapObjectKey(context, key, value);
     }
 
@@ -14,6 +14,7 @@
  */
 package org.apache.geode.internal.cache.eviction;
 
+import java.util.Collection;
 import java.util.concurrent.atomic.AtomicInteger;
 
 import org.apache.logging.log4j.Logger;
@@ -95,6 +96,20 @@ abstract class AbstractEvictionList implements EvictionList {
    */
   @Override
   public synchronized void appendEntry(final EvictionNode evictionNode) {
+    linkAtTail(evictionNode);
+  }
+
+  /**
+   * Adds lru nodes to the tail of the list, in order, while holding the list lock once.
+   */
+  @Override
+  public synchronized void appendEntries(Collection<? extends EvictionNode> evictionNodes) {
+    for (EvictionNode evictionNode : evictionNodes) {
+      linkAtTail(evictionNode);
+    }
+  }
+
+  private void linkAtTail(final EvictionNode evictionNode) {
     if (evictionNode.next() != null) {
       // already in the list
       return;
@@ -14,6 +14,8 @@
  */
 package org.apache.geode.internal.cache.eviction;
 
+import java.util.Collection;
+
 import org.apache.geode.internal.cache.BucketRegion;
 import org.apache.geode.internal.cache.versions.RegionVersionVector;
 
@@ -26,6 +28,12 @@ public interface EvictionList {
    */
   void appendEntry(EvictionNode evictionNode);
 
+  /**
+   * Adds new eviction nodes for the entries, in order, as if by calling
+   * {@link #appendEntry(EvictionNode)} for each of them.
+   */
+  void appendEntries(Collection<? extends EvictionNode> evictionNodes);
+
   /**
    * Returns the Entry that is considered least recently used. The entry will no longer be in the
    * pipe (unless it is the last empty marker).
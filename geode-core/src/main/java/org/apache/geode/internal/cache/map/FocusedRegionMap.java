@@ -21,6 +21,7 @@ import org.apache.geode.internal.cache.EntryEventImpl;
 import org.apache.geode.internal.cache.InternalRegion;
 import org.apache.geode.internal.cache.RegionEntry;
 import org.apache.geode.internal.cache.RegionEntryFactory;
+import org.apache.geode.internal.cache.RegionMapBulkLoad;
 import org.apache.geode.internal.cache.TXEntryState;
 import org.apache.geode.internal.cache.eviction.EvictableMap;
 
@@ -51,6 +52,18 @@ public interface FocusedRegionMap extends EvictableMap {
 
   void incEntryCount(int delta);
 
+  /**
+   * Returns the bulk load of the map if the current thread is loading it, otherwise null.
+   */
+  RegionMapBulkLoad getBulkLoad();
+
+  /**
+   * Counts the given entry right away if it was created by a bulk load and is still waiting for
+   * its batch. Must be called while holding the lock of the entry, before changing its size or
+   * destroying it.
+   */
+  void countBulkLoadEntry(RegionEntry regionEntry);
+
   void runWhileEvictionDisabled(Runnable runnable);
 
   void txRemoveOldIndexEntry(Operation putOp, RegionEntry regionEntry);
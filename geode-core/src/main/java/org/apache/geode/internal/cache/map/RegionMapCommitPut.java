@@ -186,6 +186,9 @@ public class RegionMapCommitPut extends AbstractRegionMapPut {
     final Object key = callbackEvent.getKey();
     final Object newValue = computeNewValue(callbackEvent);
 
+    if (!isPutOpCreate()) {
+      regionMap.countBulkLoadEntry(regionEntry);
+    }
     final int oldSize = isPutOpCreate() ? 0 : owner.calculateRegionEntryValueSize(regionEntry);
     callbackEvent.setRegionEntry(regionEntry);
     regionMap.txRemoveOldIndexEntry(getPutOp(), regionEntry);
@@ -729,6 +729,7 @@ public class RegionMapDestroy {
       boolean removeRecoveredEntry) throws CacheWriterException, TimeoutException,
       EntryNotFoundException, RegionClearedException {
     focusedRegionMap.processVersionTag(re, event);
+    focusedRegionMap.countBulkLoadEntry(re);
     final int oldSize = internalRegion.calculateRegionEntryValueSize(re);
     final boolean wasRemoved = re.isDestroyedOrRemoved();
     boolean retVal = re.destroy(event.getRegion(), event, inTokenMode, cacheWrite, expectedOldValue,
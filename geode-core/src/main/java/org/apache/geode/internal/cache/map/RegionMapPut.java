@@ -28,6 +28,7 @@ import org.apache.geode.internal.cache.EntryEventSerialization;
 import org.apache.geode.internal.cache.InternalRegion;
 import org.apache.geode.internal.cache.RegionClearedException;
 import org.apache.geode.internal.cache.RegionEntry;
+import org.apache.geode.internal.cache.RegionMapBulkLoad;
 import org.apache.geode.internal.cache.Token;
 import org.apache.geode.internal.cache.ValueComparisonHelper;
 import org.apache.geode.internal.cache.entries.AbstractRegionEntry;
@@ -62,6 +63,11 @@ public class RegionMapPut extends AbstractRegionMapPut {
   @Released
   private Object oldValueForDelta;
 
+  /** The bulk load the entry created by this put was recorded in, or null */
+  private RegionMapBulkLoad bulkLoad;
+
+  private boolean flushBulkLoad;
+
   public RegionMapPut(FocusedRegionMap focusedRegionMap, InternalRegion owner,
       CacheModificationLock cacheModificationLock, EntryEventSerialization entryEventSerialization,
       EntryEventImpl event, boolean ifNew, boolean ifOld, boolean overwriteDestroyed,
@@ -285,7 +291,10 @@ public class RegionMapPut extends AbstractRegionMapPut {
   }
 
   private void updateLru() {
-    if (!isClearOccurred()) {
+    if (bulkLoad != null) {
+      flushBulkLoad =
+          bulkLoad.entryCreated(getRegionEntry(), getEvent().getNewValueBucketSize());
+    } else if (!isClearOccurred()) {
       if (getEvent().getOperation().isCreate()) {
         getRegionMap().lruEntryCreate(getRegionEntry());
       } else {
@@ -310,6 +319,9 @@ public class RegionMapPut extends AbstractRegionMapPut {
       }
     } finally {
       finishEviction(disabledEviction);
+      if (flushBulkLoad) {
+        bulkLoad.flush();
+      }
     }
   }
 
@@ -470,7 +482,13 @@ public class RegionMapPut extends AbstractRegionMapPut {
     final boolean wasTombstone = re.isTombstone();
     getRegionMap().processVersionTag(re, event);
     event.putNewEntry(getOwner(), re);
-    updateSize(0, false, wasTombstone);
+    if (isCreate() && event.basicGetNewValue() != Token.TOMBSTONE) {
+      // the size, eviction list and entry count are updated when the batch is flushed
+      bulkLoad = getRegionMap().getBulkLoad();
+    }
+    if (bulkLoad == null) {
+      updateSize(0, false, wasTombstone);
+    }
     if (!event.getRegion().isInitialized()) {
       getOwner().getImageState().removeDestroyedEntry(event.getKey());
     }
@@ -480,6 +498,7 @@ public class RegionMapPut extends AbstractRegionMapPut {
     final EntryEventImpl event = getEvent();
     final RegionEntry re = getRegionEntry();
     final boolean wasTombstone = re.isTombstone();
+    getRegionMap().countBulkLoadEntry(re);
     final int oldSize = event.getRegion().calculateRegionEntryValueSize(re);
     getRegionMap().processVersionTag(re, event);
     event.putExistingEntry(event.getRegion(), re, isRequireOldValue(), getOldValueForDelta());
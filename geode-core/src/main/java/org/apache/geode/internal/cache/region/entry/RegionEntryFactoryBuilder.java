@@ -15,6 +15,10 @@
 package org.apache.geode.internal.cache.region.entry;
 
 import org.apache.geode.internal.cache.RegionEntryFactory;
+import org.apache.geode.internal.cache.entries.VMStatsCountLRURegionEntryHeap;
+import org.apache.geode.internal.cache.entries.VMStatsCountLRURegionEntryOffHeap;
+import org.apache.geode.internal.cache.entries.VMStatsDiskCountLRURegionEntryHeap;
+import org.apache.geode.internal.cache.entries.VMStatsDiskCountLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VMStatsDiskLRURegionEntryHeap;
 import org.apache.geode.internal.cache.entries.VMStatsDiskLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VMStatsDiskRegionEntryHeap;
@@ -23,6 +27,10 @@ import org.apache.geode.internal.cache.entries.VMStatsLRURegionEntryHeap;
 import org.apache.geode.internal.cache.entries.VMStatsLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VMStatsRegionEntryHeap;
 import org.apache.geode.internal.cache.entries.VMStatsRegionEntryOffHeap;
+import org.apache.geode.internal.cache.entries.VMThinCountLRURegionEntryHeap;
+import org.apache.geode.internal.cache.entries.VMThinCountLRURegionEntryOffHeap;
+import org.apache.geode.internal.cache.entries.VMThinDiskCountLRURegionEntryHeap;
+import org.apache.geode.internal.cache.entries.VMThinDiskCountLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VMThinDiskLRURegionEntryHeap;
 import org.apache.geode.internal.cache.entries.VMThinDiskLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VMThinDiskRegionEntryHeap;
@@ -31,6 +39,10 @@ import org.apache.geode.internal.cache.entries.VMThinLRURegionEntryHeap;
 import org.apache.geode.internal.cache.entries.VMThinLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VMThinRegionEntryHeap;
 import org.apache.geode.internal.cache.entries.VMThinRegionEntryOffHeap;
+import org.apache.geode.internal.cache.entries.VersionedStatsCountLRURegionEntryHeap;
+import org.apache.geode.internal.cache.entries.VersionedStatsCountLRURegionEntryOffHeap;
+import org.apache.geode.internal.cache.entries.VersionedStatsDiskCountLRURegionEntryHeap;
+import org.apache.geode.internal.cache.entries.VersionedStatsDiskCountLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VersionedStatsDiskLRURegionEntryHeap;
 import org.apache.geode.internal.cache.entries.VersionedStatsDiskLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VersionedStatsDiskRegionEntryHeap;
@@ -39,6 +51,10 @@ import org.apache.geode.internal.cache.entries.VersionedStatsLRURegionEntryHeap;
 import org.apache.geode.internal.cache.entries.VersionedStatsLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VersionedStatsRegionEntryHeap;
 import org.apache.geode.internal.cache.entries.VersionedStatsRegionEntryOffHeap;
+import org.apache.geode.internal.cache.entries.VersionedThinCountLRURegionEntryHeap;
+import org.apache.geode.internal.cache.entries.VersionedThinCountLRURegionEntryOffHeap;
+import org.apache.geode.internal.cache.entries.VersionedThinDiskCountLRURegionEntryHeap;
+import org.apache.geode.internal.cache.entries.VersionedThinDiskCountLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VersionedThinDiskLRURegionEntryHeap;
 import org.apache.geode.internal.cache.entries.VersionedThinDiskLRURegionEntryOffHeap;
 import org.apache.geode.internal.cache.entries.VersionedThinDiskRegionEntryHeap;
@@ -51,6 +67,18 @@ import org.apache.geode.internal.cache.entries.VersionedThinRegionEntryOffHeap;
 public class RegionEntryFactoryBuilder {
   public RegionEntryFactory create(boolean statsEnabled, boolean isLRU, boolean isDisk,
       boolean withVersioning, boolean offHeap) {
+    return create(statsEnabled, isLRU, false, isDisk, withVersioning, offHeap);
+  }
+
+  /**
+   * @param isEntryCountLRU true if the region evicts by entry count, in which case entries that do
+   *        not keep a size field are used. Ignored unless isLRU is true.
+   */
+  public RegionEntryFactory create(boolean statsEnabled, boolean isLRU, boolean isEntryCountLRU,
+      boolean isDisk, boolean withVersioning, boolean offHeap) {
+    if (isLRU && isEntryCountLRU) {
+      return createEntryCountLRU(statsEnabled, isDisk, withVersioning, offHeap);
+    }
     int bitRepresentation = 0;
     bitRepresentation |= statsEnabled ? 1 : 0;
     bitRepresentation |= isLRU ? 2 : 0;
@@ -130,4 +158,53 @@ public class RegionEntryFactoryBuilder {
         throw new IllegalStateException("unexpected bitRepresentation " + bitRepresentation);
     }
   }
+
+  private RegionEntryFactory createEntryCountLRU(boolean statsEnabled, boolean isDisk,
+      boolean withVersioning, boolean offHeap) {
+    int bitRepresentation = 0;
+    bitRepresentation |= statsEnabled ? 1 : 0;
+    bitRepresentation |= isDisk ? 2 : 0;
+    bitRepresentation |= withVersioning ? 4 : 0;
+    bitRepresentation |= offHeap ? 8 : 0;
+
+    /**
+     * The bits represent all options |offHeap|versioning|disk|stats|
+     */
+    switch (bitRepresentation) {
+      case (0):
+        return VMThinCountLRURegionEntryHeap.getEntryFactory(); // Bits: 0000
+      case (1):
+        return VMStatsCountLRURegionEntryHeap.getEntryFactory(); // Bits: 0001
+      case (2):
+        return VMThinDiskCountLRURegionEntryHeap.getEntryFactory(); // Bits: 0010
+      case (3):
+        return VMStatsDiskCountLRURegionEntryHeap.getEntryFactory(); // Bits: 0011
+      case (4):
+        return VersionedThinCountLRURegionEntryHeap.getEntryFactory(); // Bits: 0100
+      case (5):
+        return VersionedStatsCountLRURegionEntryHeap.getEntryFactory(); // Bits: 0101
+      case (6):
+        return VersionedThinDiskCountLRURegionEntryHeap.getEntryFactory(); // Bits: 0110
+      case (7):
+        return VersionedStatsDiskCountLRURegionEntryHeap.getEntryFactory(); // Bits: 0111
+      case (8):
+        return VMThinCountLRURegionEntryOffHeap.getEntryFactory(); // Bits: 1000
+      case (9):
+        return VMStatsCountLRURegionEntryOffHeap.getEntryFactory(); // Bits: 1001
+      case (10):
+        return VMThinDiskCountLRURegionEntryOffHeap.getEntryFactory(); // Bits: 1010
+      case (11):
+        return VMStatsDiskCountLRURegionEntryOffHeap.getEntryFactory(); // Bits: 1011
+      case (12):
+        return VersionedThinCountLRURegionEntryOffHeap.getEntryFactory(); // Bits: 1100
+      case (13):
+        return VersionedStatsCountLRURegionEntryOffHeap.getEntryFactory(); // Bits: 1101
+      case (14):
+        return VersionedThinDiskCountLRURegionEntryOffHeap.getEntryFactory(); // Bits: 1110
+      case (15):
+        return VersionedStatsDiskCountLRURegionEntryOffHeap.getEntryFactory(); // Bits: 1111
+      default:
+        throw new IllegalStateException("unexpected bitRepresentation " + bitRepresentation);
+    }
+  }
 }
@@ -53,6 +53,7 @@ import org.apache.geode.internal.cache.CachedDeserializableFactory;
 import org.apache.geode.internal.cache.InternalCache;
 import org.apache.geode.internal.cache.LocalDataSet;
 import org.apache.geode.internal.cache.LocalRegion;
+import org.apache.geode.internal.cache.RegionMap;
 import org.apache.geode.internal.cache.Token;
 import org.apache.geode.internal.cache.execute.InternalFunction;
 import org.apache.geode.internal.cache.snapshot.GFSnapshot.GFSnapshotImporter;
@@ -285,7 +286,7 @@ public class RegionSnapshotServiceImpl<K, V> implements RegionSnapshotService<K,
             final Map<K, V> copy = new HashMap<>(buffer);
             Future<?> f = local.getCache().getDistributionManager().getExecutors()
                 .getWaitingThreadPool().submit(
-                    (Runnable) () -> local.basicImportPutAll(copy,
+                    (Runnable) () -> importEntries(local, copy,
                         !options.shouldInvokeCallbacks()));
 
             puts.addLast(f);
@@ -297,7 +298,7 @@ public class RegionSnapshotServiceImpl<K, V> implements RegionSnapshotService<K,
 
       // send off any remaining entries
       if (!buffer.isEmpty()) {
-        local.basicImportPutAll(buffer, !options.shouldInvokeCallbacks());
+        importEntries(local, buffer, !options.shouldInvokeCallbacks());
       }
 
       // wait for completion and check for errors
@@ -330,6 +331,21 @@ public class RegionSnapshotServiceImpl<K, V> implements RegionSnapshotService<K,
     }
   }
 
+  /**
+   * Puts the imported entries into the region as a bulk load of the current thread. The entries of
+   * a partitioned region are created by its buckets, possibly on other members, so they are not
+   * loaded in bulk.
+   */
+  private void importEntries(LocalRegion local, Map<K, V> entries, boolean skipCallbacks) {
+    final RegionMap regionMap = local.getRegionMap();
+    regionMap.beginBulkLoad();
+    try {
+      local.basicImportPutAll(entries, skipCallbacks);
+    } finally {
+      regionMap.endBulkLoad();
+    }
+  }
+
   private void exportOnMember(File snapshot, SnapshotFormat format, SnapshotOptions<K, V> options)
       throws IOException {
     if (!snapshot.getName().endsWith(SNAPSHOT_FILE_EXTENSION)) {
@@ -694,6 +694,65 @@ public class FreeListManager {
     return null; // did not find enough free space in this fragment
   }
 
+  /**
+   * Allocates a chunk for an object that the {@link OffHeapCompactor} is relocating. Unlike
+   * {@link #allocate(int)} the chunk is only carved out of a fragment whose free space starts below
+   * sourceAddr, so relocated objects get packed at the front of the slabs. The free lists are not
+   * used and no defragmentation is done.
+   *
+   * @param size minimum bytes the returned chunk must have.
+   * @param sourceAddr the address of the chunk currently holding the object.
+   * @return the allocated chunk or null if no fragment below sourceAddr has room for it.
+   */
+  OffHeapStoredObject allocateForRelocation(int size, long sourceAddr) {
+    assert size > 0;
+    int chunkSize = size + OffHeapStoredObject.HEADER_SIZE;
+    if (chunkSize <= MAX_TINY) {
+      chunkSize = (getNearestTinyMultiple(chunkSize) + 1) * TINY_MULTIPLE;
+    } else {
+      chunkSize = round(TINY_MULTIPLE, chunkSize);
+    }
+    for (Fragment fragment : this.fragmentList) {
+      OffHeapStoredObject result = allocateFromFragmentBelow(fragment, chunkSize, sourceAddr);
+      if (result != null) {
+        result.setDataSize(size);
+        this.allocatedSize.addAndGet(result.getSize());
+        result.initializeUseCount();
+        return result;
+      }
+    }
+    return null;
+  }
+
+  private OffHeapStoredObject allocateFromFragmentBelow(Fragment fragment, int chunkSize,
+      long limitAddr) {
+    int oldOffset;
+    int newOffset;
+    int extraSize;
+    do {
+      oldOffset = fragment.getFreeIndex();
+      if (fragment.getAddress() + oldOffset >= limitAddr) {
+        return null;
+      }
+      int fragmentSize = fragment.getSize();
+      if (fragmentSize - oldOffset < chunkSize) {
+        return null;
+      }
+      newOffset = oldOffset + chunkSize;
+      extraSize = fragmentSize - newOffset;
+      if (extraSize < OffHeapStoredObject.MIN_CHUNK_SIZE) {
+        // include these last few bytes of the fragment in the allocation.
+        newOffset += extraSize;
+      } else {
+        extraSize = 0;
+      }
+    } while (!fragment.allocate(oldOffset, newOffset));
+    OffHeapStoredObject result =
+        new OffHeapStoredObject(fragment.getAddress() + oldOffset, chunkSize + extraSize);
+    checkDataIntegrity(result);
+    return result;
+  }
+
   private int round(int multiple, int value) {
     return (int) ((((long) value + (multiple - 1)) / multiple) * multiple);
   }
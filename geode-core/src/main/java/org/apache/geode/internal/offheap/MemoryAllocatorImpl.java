@@ -295,6 +295,24 @@ public class MemoryAllocatorImpl implements MemoryAllocator {
 
   private OffHeapStoredObject allocateOffHeapStoredObject(int size) {
     OffHeapStoredObject result = this.freeList.allocate(size);
+    allocated(result);
+    return result;
+  }
+
+  /**
+   * Allocates a chunk below sourceAddr for an object being relocated by the
+   * {@link OffHeapCompactor}. Returns null if there is no free space below sourceAddr that is big
+   * enough.
+   */
+  OffHeapStoredObject allocateForRelocation(int size, long sourceAddr) {
+    OffHeapStoredObject result = this.freeList.allocateForRelocation(size, sourceAddr);
+    if (result != null) {
+      allocated(result);
+    }
+    return result;
+  }
+
+  private void allocated(OffHeapStoredObject result) {
     int resultSize = result.getSize();
     stats.incObjects(1);
     stats.incUsedMemory(resultSize);
@@ -303,7 +321,6 @@ public class MemoryAllocatorImpl implements MemoryAllocator {
     if (ReferenceCountHelper.trackReferenceCounts()) {
       ReferenceCountHelper.refCountChanged(result.getAddress(), false, 1);
     }
-    return result;
   }
 
   @Override
@@ -0,0 +1,256 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.offheap;
+
+import java.util.Collection;
+import java.util.concurrent.ScheduledExecutorService;
+import java.util.concurrent.TimeUnit;
+
+import org.apache.logging.log4j.Logger;
+
+import org.apache.geode.internal.cache.InternalCache;
+import org.apache.geode.internal.cache.InternalRegion;
+import org.apache.geode.internal.cache.RegionEntry;
+import org.apache.geode.internal.cache.entries.OffHeapRegionEntry;
+import org.apache.geode.logging.internal.executors.LoggingExecutors;
+import org.apache.geode.logging.internal.log4j.api.LogService;
+import org.apache.geode.util.internal.GeodeGlossary;
+
+/**
+ * Relocates live off-heap values of region entries into free space at the front of the slabs so
+ * that the chunks they leave behind can be coalesced into large fragments by the next
+ * defragmentation.
+ *
+ * <p>
+ * A value is moved while its entry is synchronized, the same way region operations change it. The
+ * compactor copies the value into a chunk at a lower address and swaps the entry's address with the
+ * compare-and-set used by {@link OffHeapRegionEntryHelper#setValue}. Threads that retained the old
+ * chunk before the swap keep reading it until they release it, since its data never changes.
+ * Values that are retained by anything other than their entry are skipped.
+ *
+ * <p>
+ * Compaction is disabled unless {@link #INTERVAL_PROPERTY} is set. Each pass starts with a
+ * defragmentation and is skipped if the resulting fragmentation is below
+ * {@link #FRAGMENTATION_THRESHOLD_PROPERTY}. The number of bytes copied per second is limited by
+ * {@link #BYTES_PER_SECOND_PROPERTY}.
+ */
+public class OffHeapCompactor {
+  private static final Logger logger = LogService.getLogger();
+
+  /**
+   * The number of milliseconds between compaction passes. Compaction is disabled if this is not
+   * greater than zero.
+   */
+  public static final String INTERVAL_PROPERTY =
+      GeodeGlossary.GEMFIRE_PREFIX + "OFF_HEAP_COMPACTION_INTERVAL_MS";
+
+  /**
+   * The maximum number of bytes a compaction pass copies per second. No limit if not greater than
+   * zero.
+   */
+  public static final String BYTES_PER_SECOND_PROPERTY =
+      GeodeGlossary.GEMFIRE_PREFIX + "OFF_HEAP_COMPACTION_BYTES_PER_SECOND";
+
+  /**
+   * The percentage of fragmentation of the free off-heap memory at which a compaction pass
+   * relocates values.
+   */
+  public static final String FRAGMENTATION_THRESHOLD_PROPERTY =
+      GeodeGlossary.GEMFIRE_PREFIX + "OFF_HEAP_COMPACTION_FRAGMENTATION_THRESHOLD";
+
+  private static final long INTERVAL = Long.getLong(INTERVAL_PROPERTY, 0);
+
+  private static final long BYTES_PER_SECOND =
+      Long.getLong(BYTES_PER_SECOND_PROPERTY, 64 * 1024 * 1024);
+
+  private static final int FRAGMENTATION_THRESHOLD =
+      Integer.getInteger(FRAGMENTATION_THRESHOLD_PROPERTY, 25);
+
+  private final InternalCache cache;
+
+  private final MemoryAllocatorImpl allocator;
+
+  private final long bytesPerSecond;
+
+  private final int fragmentationThreshold;
+
+  private ScheduledExecutorService exec;
+
+  private volatile boolean closed;
+
+  /** The time the current pass started copying, used to limit the rate. */
+  private long passStartNanos;
+
+  /** The number of bytes copied by the current pass, used to limit the rate. */
+  private long passBytesMoved;
+
+  /**
+   * Creates and starts a compactor for the off-heap memory of the given cache. Returns null if
+   * compaction is disabled or the cache does not use off-heap memory.
+   */
+  public static OffHeapCompactor startIfEnabled(InternalCache cache, MemoryAllocator allocator) {
+    if (INTERVAL <= 0 || !(allocator instanceof MemoryAllocatorImpl)) {
+      return null;
+    }
+    OffHeapCompactor result = new OffHeapCompactor(cache, (MemoryAllocatorImpl) allocator,
+        BYTES_PER_SECOND, FRAGMENTATION_THRESHOLD);
+    result.start(INTERVAL);
+    return result;
+  }
+
+  OffHeapCompactor(InternalCache cache, MemoryAllocatorImpl allocator, long bytesPerSecond,
+      int fragmentationThreshold) {
+    this.cache = cache;
+    this.allocator = allocator;
+    this.bytesPerSecond = bytesPerSecond;
+    this.fragmentationThreshold = fragmentationThreshold;
+  }
+
+  private void start(long interval) {
+    exec = LoggingExecutors.newScheduledThreadPool("OffHeapCompactor", 1, false);
+    exec.scheduleWithFixedDelay(() -> {
+      try {
+        compact();
+      } catch (Exception e) {
+        if (!closed) {
+          logger.error("The off-heap compactor has encountered an error", e);
+        }
+      }
+    }, interval, interval, TimeUnit.MILLISECONDS);
+  }
+
+  public void close() {
+    closed = true;
+    if (exec != null) {
+      exec.shutdownNow();
+    }
+  }
+
+  /**
+   * Makes one compaction pass over the off-heap regions of the cache if the free off-heap memory is
+   * fragmented enough.
+   */
+  void compact() {
+    if (!needsCompaction()) {
+      return;
+    }
+    final OffHeapMemoryStats stats = allocator.getStats();
+    final long start = stats.startCompaction();
+    passStartNanos = System.nanoTime();
+    passBytesMoved = 0;
+    try {
+      for (InternalRegion region : cache.getAllRegions()) {
+        if (closed) {
+          return;
+        }
+        if (region.getAttributes().getOffHeap() && !region.isDestroyed()) {
+          compact(region.getRegionMap().regionEntries());
+        }
+      }
+    } finally {
+      stats.endCompaction(start);
+    }
+  }
+
+  /**
+   * Defragments the free off-heap memory and returns true if it is still fragmented enough for a
+   * compaction pass to be worthwhile.
+   */
+  boolean needsCompaction() {
+    FreeListManager freeList = allocator.getFreeListManager();
+    freeList.defragment(0);
+    return freeList.getFragmentation() >= fragmentationThreshold;
+  }
+
+  private void compact(Collection<RegionEntry> entries) {
+    for (RegionEntry re : entries) {
+      if (closed) {
+        return;
+      }
+      if (re instanceof OffHeapRegionEntry) {
+        int moved = relocate((OffHeapRegionEntry) re);
+        if (moved > 0) {
+          passBytesMoved += moved;
+          throttle();
+        }
+      }
+    }
+  }
+
+  /**
+   * Moves the off-heap value of the given entry into a chunk at a lower address.
+   *
+   * @return the number of bytes of data that were moved, or zero if the value was not moved.
+   */
+  int relocate(OffHeapRegionEntry re) {
+    synchronized (re) {
+      final long oldAddress = re.getAddress();
+      if (!OffHeapRegionEntryHelper.isOffHeap(oldAddress)
+          || !OffHeapStoredObject.retain(oldAddress)) {
+        return 0;
+      }
+      try {
+        if (OffHeapStoredObject.getRefCount(oldAddress) != 2) {
+          // the value is in use by something other than its entry
+          return 0;
+        }
+        final OffHeapStoredObject source = new OffHeapStoredObject(oldAddress);
+        final int dataSize = source.getDataSize();
+        final OffHeapStoredObject target = allocator.allocateForRelocation(dataSize, oldAddress);
+        if (target == null) {
+          return 0;
+        }
+        AddressableMemoryManager.copyMemory(source.getBaseDataAddress(),
+            target.getBaseDataAddress(), dataSize);
+        target.setSerialized(source.isSerialized());
+        target.setCompressed(source.isCompressed());
+        if (!re.setAddress(oldAddress, target.getAddress())) {
+          target.release();
+          return 0;
+        }
+        // the entry now references target so release its reference to the old chunk
+        ReferenceCountHelper.setReferenceCountOwner(re);
+        OffHeapStoredObject.release(oldAddress);
+        ReferenceCountHelper.setReferenceCountOwner(null);
+
+        final OffHeapMemoryStats stats = allocator.getStats();
+        stats.incCompactionObjectsMoved(1);
+        stats.incCompactionBytesMoved(dataSize);
+        return dataSize;
+      } finally {
+        OffHeapStoredObject.release(oldAddress);
+      }
+    }
+  }
+
+  /**
+   * Sleeps long enough to keep the bytes copied by the current pass within the configured rate.
+   */
+  private void throttle() {
+    if (bytesPerSecond <= 0) {
+      return;
+    }
+    long expectedNanos = (long) (passBytesMoved * (1e9 / bytesPerSecond));
+    long sleepNanos = expectedNanos - (System.nanoTime() - passStartNanos);
+    if (sleepNanos >= TimeUnit.MILLISECONDS.toNanos(1)) {
+      try {
+        TimeUnit.NANOSECONDS.sleep(sleepNanos);
+      } catch (InterruptedException e) {
+        Thread.currentThread().interrupt();
+        closed = true;
+      }
+    }
+  }
+}
@@ -43,6 +43,14 @@ public interface OffHeapMemoryStats {
 
   void setFragmentation(int value);
 
+  long startCompaction();
+
+  void endCompaction(long start);
+
+  void incCompactionObjectsMoved(int value);
+
+  void incCompactionBytesMoved(long value);
+
   long getFreeMemory();
 
   long getMaxMemory();
@@ -65,6 +73,14 @@ public interface OffHeapMemoryStats {
 
   long getDefragmentationTime();
 
+  int getCompactions();
+
+  long getCompactionTime();
+
+  long getCompactionObjectsMoved();
+
+  long getCompactionBytesMoved();
+
   Statistics getStats();
 
   void close();
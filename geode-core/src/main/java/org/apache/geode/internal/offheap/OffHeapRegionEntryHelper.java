@@ -14,6 +14,9 @@
  */
 package org.apache.geode.internal.offheap;
 
+import java.util.Arrays;
+
+import org.apache.geode.SerializationException;
 import org.apache.geode.annotations.Immutable;
 import org.apache.geode.internal.cache.CachedDeserializableFactory;
 import org.apache.geode.internal.cache.DiskId;
@@ -22,10 +25,12 @@ import org.apache.geode.internal.cache.RegionEntryContext;
 import org.apache.geode.internal.cache.Token;
 import org.apache.geode.internal.cache.entries.DiskEntry;
 import org.apache.geode.internal.cache.entries.OffHeapRegionEntry;
+import org.apache.geode.internal.cache.entries.SerializedKeyRegionEntry;
 import org.apache.geode.internal.offheap.annotations.Released;
 import org.apache.geode.internal.offheap.annotations.Retained;
 import org.apache.geode.internal.offheap.annotations.Unretained;
 import org.apache.geode.internal.serialization.DSCODE;
+import org.apache.geode.util.internal.GeodeGlossary;
 
 /**
  * The class just has static methods that operate on instances of {@link OffHeapRegionEntry}. It
@@ -47,6 +52,14 @@ public class OffHeapRegionEntryHelper {
   protected static final long TOMBSTONE_ADDRESS = 8L << 1;
   public static final int MAX_LENGTH_FOR_DATA_AS_ADDRESS = 8;
 
+  /**
+   * If true, off-heap regions create a {@link SerializedKeyRegionEntry} for keys that can not be
+   * stored inline. Since those entries compare keys by their serialized form, this must only be
+   * set if equal keys always serialize to the same bytes.
+   */
+  public static final boolean OFF_HEAP_REGION_KEYS =
+      Boolean.getBoolean(GeodeGlossary.GEMFIRE_PREFIX + "OFF_HEAP_REGION_KEYS");
+
   @Immutable
   private static final Token[] addrToObj =
       new Token[] {null, Token.INVALID, Token.LOCAL_INVALID, Token.DESTROYED, Token.REMOVED_PHASE1,
@@ -195,6 +208,9 @@ public class OffHeapRegionEntryHelper {
     final long newAddress = objectToAddress(Token.REMOVED_PHASE2);
     if (re.setAddress(oldAddress, newAddress)) {
       releaseAddress(oldAddress);
+      if (re instanceof SerializedKeyRegionEntry) {
+        releaseKey((SerializedKeyRegionEntry) re);
+      }
     } /*
        * else { if (!calledSetValue || re.getAddress() != newAddress) { expectedValue.release(); } }
        */
@@ -416,6 +432,154 @@ public class OffHeapRegionEntryHelper {
 
 
 
+  /**
+   * Moves the key of the given entry off-heap. Called before the entry is added to a region map,
+   * outside of the map's locks, since the key is serialized and allocated here. If the entry is not
+   * added after all, its key must be given back with {@link #returnKeyToHeap}. The key stays on the
+   * heap if it can not be serialized.
+   */
+  public static void storeKeyOffHeap(@Unretained SerializedKeyRegionEntry re) {
+    final Object key = re.getHeapKey();
+    if (key == null || re.getKeyAddress() != NULL_ADDRESS
+        || re.getAddress() == REMOVED_PHASE2_ADDRESS) {
+      return;
+    }
+    final byte[] serializedKey;
+    try {
+      serializedKey = EntryEventImpl.serialize(key);
+    } catch (SerializationException ignore) {
+      return;
+    }
+    @Retained
+    StoredObject so =
+        MemoryAllocatorImpl.getAllocator().allocateAndInitialize(serializedKey, true, false);
+    if (re.setKeyAddress(NULL_ADDRESS, so.getAddress())) {
+      // readers look at the heap key first, so it is cleared once the address is set
+      re.setHeapKey(null);
+    } else {
+      so.release();
+    }
+  }
+
+  /**
+   * Returns the key of the given entry, deserializing it if it is stored off-heap. Returns null if
+   * the key was released because the entry was removed from its region map.
+   */
+  public static Object getKey(@Unretained SerializedKeyRegionEntry re) {
+    for (;;) {
+      final Object key = re.getHeapKey();
+      if (key != null) {
+        return key;
+      }
+      final long keyAddress = re.getKeyAddress();
+      if (keyAddress == NULL_ADDRESS) {
+        // the key was either given back to the heap or released
+        return re.getHeapKey();
+      }
+      final byte[] serializedKey = readKey(re, keyAddress);
+      if (serializedKey != null) {
+        return EntryEventImpl.deserialize(serializedKey);
+      }
+      // the key was given back or released while it was read
+    }
+  }
+
+  /**
+   * Returns true if the given key is equal to the key of the given entry. A key stored off-heap is
+   * compared to the serialized form of the given key, without deserializing it.
+   */
+  public static boolean isKeyEqual(@Unretained SerializedKeyRegionEntry re, Object key) {
+    byte[] serializedKey = null;
+    for (;;) {
+      final Object heapKey = re.getHeapKey();
+      if (heapKey != null) {
+        return key.equals(heapKey);
+      }
+      if (serializedKey == null) {
+        try {
+          serializedKey = EntryEventImpl.serialize(key);
+        } catch (SerializationException | IllegalArgumentException ignore) {
+          return false;
+        }
+      }
+      final long keyAddress = re.getKeyAddress();
+      if (keyAddress == NULL_ADDRESS) {
+        // the key was either given back to the heap or released
+        final Object movedKey = re.getHeapKey();
+        return movedKey != null && key.equals(movedKey);
+      }
+      final byte[] entryKey = readKey(re, keyAddress);
+      if (entryKey != null) {
+        return Arrays.equals(entryKey, serializedKey);
+      }
+      // the key was given back or released while it was read
+    }
+  }
+
+  /**
+   * Returns the serialized key stored at the given key address of the entry, or null if the key
+   * is not stored there anymore.
+   */
+  private static byte[] readKey(@Unretained SerializedKeyRegionEntry re, long keyAddress) {
+    if (keyAddress == NULL_ADDRESS) {
+      return null;
+    }
+    if (!isOffHeap(keyAddress)) {
+      return decodeAddressToRawBytes(keyAddress);
+    }
+    if (!OffHeapStoredObject.retain(keyAddress)) {
+      return null;
+    }
+    try {
+      if (re.getKeyAddress() != keyAddress) {
+        // the address was released and allocated again for something else
+        return null;
+      }
+      return new OffHeapStoredObject(keyAddress).getRawBytes();
+    } finally {
+      OffHeapStoredObject.release(keyAddress);
+    }
+  }
+
+  /**
+   * Gives the given key back to an entry that was not added to its region map, so that it can be
+   * added again later, and releases the off-heap copy of the key. The caller's key is used so that
+   * the off-heap copy does not need to be deserialized. The heap key is set before the address is
+   * cleared so that concurrent readers always find the key in one of the two.
+   */
+  public static void returnKeyToHeap(@Unretained SerializedKeyRegionEntry re, Object key) {
+    final long keyAddress = re.getKeyAddress();
+    if (keyAddress == NULL_ADDRESS) {
+      return;
+    }
+    re.setHeapKey(key);
+    if (re.setKeyAddress(keyAddress, NULL_ADDRESS)) {
+      releaseAddress(keyAddress);
+    }
+  }
+
+  /**
+   * Releases the off-heap memory of the key of the given entry without deserializing it. Called
+   * once the entry is dead: it has been removed from its region map, which never adds it back, or
+   * its region map was cleared or closed. The entry has no key after this.
+   */
+  public static void releaseKey(@Unretained SerializedKeyRegionEntry re) {
+    final long keyAddress = re.getKeyAddress();
+    if (keyAddress != NULL_ADDRESS && re.setKeyAddress(keyAddress, NULL_ADDRESS)) {
+      releaseAddress(keyAddress);
+    }
+  }
+
+  /**
+   * Releases the off-heap key of the given value removed from a region entry map, if it is an
+   * entry that stores its key off-heap. A region entry is its own map value.
+   */
+  public static void releaseKeyOfRemovedEntry(Object removed) {
+    if (removed instanceof SerializedKeyRegionEntry) {
+      releaseKey((SerializedKeyRegionEntry) removed);
+    }
+  }
+
   public static boolean isSerialized(long address) {
     return (address & SERIALIZED_BIT) != 0;
   }
@@ -61,6 +61,10 @@ public class OffHeapStorage implements OffHeapMemoryStats {
   private static final int defragmentationTimeId;
   private static final int fragmentationId;
   private static final int defragmentationsInProgressId;
+  private static final int compactionsId;
+  private static final int compactionTimeId;
+  private static final int compactionObjectsMovedId;
+  private static final int compactionBytesMovedId;
   // NOTE!!!! When adding new stats make sure and update the initialize method on this class
 
   // creates and registers the statistics type
@@ -87,6 +91,14 @@ public class OffHeapStorage implements OffHeapMemoryStats {
         "The total number of reads of off-heap memory. Only reads of a full object increment this statistic. If only a part of the object is read this statistic is not incremented.";
     final String maxMemoryDesc =
         "The maximum amount of off-heap memory, in bytes. This is the amount of memory allocated at startup and does not change.";
+    final String compactionsDesc =
+        "The total number of passes the background compactor has made over the live off-heap objects.";
+    final String compactionTimeDesc =
+        "The total time spent relocating live off-heap objects by the background compactor.";
+    final String compactionObjectsMovedDesc =
+        "The total number of live off-heap objects relocated by the background compactor.";
+    final String compactionBytesMovedDesc =
+        "The total number of bytes of live off-heap data relocated by the background compactor.";
 
     final String usedMemory = "usedMemory";
     final String defragmentations = "defragmentations";
@@ -99,6 +111,10 @@ public class OffHeapStorage implements OffHeapMemoryStats {
     final String objects = "objects";
     final String reads = "reads";
     final String maxMemory = "maxMemory";
+    final String compactions = "compactions";
+    final String compactionTime = "compactionTime";
+    final String compactionObjectsMoved = "compactionObjectsMoved";
+    final String compactionBytesMoved = "compactionBytesMoved";
 
     statsType = f.createType(statsTypeName, statsTypeDescription,
         new StatisticDescriptor[] {f.createLongGauge(usedMemory, usedMemoryDesc, "bytes"),
@@ -112,7 +128,11 @@ public class OffHeapStorage implements OffHeapMemoryStats {
             f.createIntGauge(largestFragment, largestFragmentDesc, "bytes"),
             f.createIntGauge(objects, objectsDesc, "objects"),
             f.createLongCounter(reads, readsDesc, "operations"),
-            f.createLongGauge(maxMemory, maxMemoryDesc, "bytes"),});
+            f.createLongGauge(maxMemory, maxMemoryDesc, "bytes"),
+            f.createIntCounter(compactions, compactionsDesc, "operations"),
+            f.createLongCounter(compactionTime, compactionTimeDesc, "nanoseconds", false),
+            f.createLongCounter(compactionObjectsMoved, compactionObjectsMovedDesc, "objects"),
+            f.createLongCounter(compactionBytesMoved, compactionBytesMovedDesc, "bytes"),});
 
     usedMemoryId = statsType.nameToId(usedMemory);
     defragmentationId = statsType.nameToId(defragmentations);
@@ -125,6 +145,10 @@ public class OffHeapStorage implements OffHeapMemoryStats {
     objectsId = statsType.nameToId(objects);
     readsId = statsType.nameToId(reads);
     maxMemoryId = statsType.nameToId(maxMemory);
+    compactionsId = statsType.nameToId(compactions);
+    compactionTimeId = statsType.nameToId(compactionTime);
+    compactionObjectsMovedId = statsType.nameToId(compactionObjectsMoved);
+    compactionBytesMovedId = statsType.nameToId(compactionBytesMoved);
   }
 
   public static long parseOffHeapMemorySize(String value) {
@@ -387,6 +411,49 @@ public class OffHeapStorage implements OffHeapMemoryStats {
     return this.stats.getInt(fragmentationId);
   }
 
+  @Override
+  public long startCompaction() {
+    return DistributionStats.getStatTime();
+  }
+
+  @Override
+  public void endCompaction(long start) {
+    this.stats.incInt(compactionsId, 1);
+    if (DistributionStats.enableClockStats) {
+      stats.incLong(compactionTimeId, DistributionStats.getStatTime() - start);
+    }
+  }
+
+  @Override
+  public int getCompactions() {
+    return this.stats.getInt(compactionsId);
+  }
+
+  @Override
+  public long getCompactionTime() {
+    return this.stats.getLong(compactionTimeId);
+  }
+
+  @Override
+  public void incCompactionObjectsMoved(int value) {
+    this.stats.incLong(compactionObjectsMovedId, value);
+  }
+
+  @Override
+  public long getCompactionObjectsMoved() {
+    return this.stats.getLong(compactionObjectsMovedId);
+  }
+
+  @Override
+  public void incCompactionBytesMoved(long value) {
+    this.stats.incLong(compactionBytesMovedId, value);
+  }
+
+  @Override
+  public long getCompactionBytesMoved() {
+    return this.stats.getLong(compactionBytesMovedId);
+  }
+
   @Override
   public Statistics getStats() {
     return this.stats;
@@ -410,10 +477,30 @@ public class OffHeapStorage implements OffHeapMemoryStats {
     setLargestFragment(oldStats.getLargestFragment());
     setDefragmentationTime(oldStats.getDefragmentationTime());
     setFragmentation(oldStats.getFragmentation());
+    setCompactions(oldStats.getCompactions());
+    setCompactionTime(oldStats.getCompactionTime());
+    setCompactionObjectsMoved(oldStats.getCompactionObjectsMoved());
+    setCompactionBytesMoved(oldStats.getCompactionBytesMoved());
 
     oldStats.close();
   }
 
+  private void setCompactions(int value) {
+    this.stats.setInt(compactionsId, value);
+  }
+
+  private void setCompactionTime(long value) {
+    this.stats.setLong(compactionTimeId, value);
+  }
+
+  private void setCompactionObjectsMoved(long value) {
+    this.stats.setLong(compactionObjectsMovedId, value);
+  }
+
+  private void setCompactionBytesMoved(long value) {
+    this.stats.setLong(compactionBytesMovedId, value);
+  }
+
   private void setDefragmentationTime(long value) {
     stats.setLong(defragmentationTimeId, value);
   }
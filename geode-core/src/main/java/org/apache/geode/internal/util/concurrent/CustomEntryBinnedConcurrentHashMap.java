@@ -0,0 +1,1442 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+/*
+ * The table, sizing and cooperative resize of this class are adapted from the JDK 8
+ * ConcurrentHashMap, written by Doug Lea with assistance from members of JCP JSR-166 Expert Group
+ * and released to the public domain, as explained at
+ * http://creativecommons.org/publicdomain/zero/1.0/
+ */
+package org.apache.geode.internal.util.concurrent;
+
+import java.util.AbstractCollection;
+import java.util.AbstractMap;
+import java.util.AbstractSet;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.Iterator;
+import java.util.Map;
+import java.util.NoSuchElementException;
+import java.util.Set;
+import java.util.concurrent.Executor;
+import java.util.concurrent.atomic.AtomicIntegerFieldUpdater;
+import java.util.concurrent.atomic.AtomicReferenceArray;
+import java.util.concurrent.atomic.LongAdder;
+import java.util.concurrent.locks.StampedLock;
+
+import org.apache.geode.internal.cache.entries.OffHeapRegionEntry;
+import org.apache.geode.internal.offheap.OffHeapRegionEntryHelper;
+import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap.HashEntry;
+import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap.HashEntryCreator;
+import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap.MapCallback;
+import org.apache.geode.util.internal.GeodeGlossary;
+
+/**
+ * A hash table of {@link HashEntry} nodes, like {@link CustomEntryConcurrentHashMap}, that is not
+ * divided into a fixed number of segments. It follows the design of the JDK 8 ConcurrentHashMap:
+ *
+ * <ul>
+ * <li>Reads do not lock unless a write to the bin they read overlaps with them.
+ * <li>An entry is added to an empty bin with a compare-and-set.
+ * <li>Adding to or removing from a bin that is not empty locks only that bin.
+ * <li>The table is resized incrementally. Threads that add to the map while it is being resized
+ * help transfer its bins to the new table.
+ * </ul>
+ *
+ * <p>
+ * The nodes are created by the {@link HashEntryCreator}, so the RegionEntries can still be the
+ * nodes themselves. Because a node is linked into the map through its own
+ * {@link HashEntry#setNextEntry}, a resize relinks the nodes of a bin instead of copying them. A
+ * bin is therefore marked as moved before its nodes are relinked, and the move completes while the
+ * lock of the bin is held. Writes to a bin that has been marked as moved wait for its lock before
+ * they go on in the new table.
+ *
+ * <p>
+ * The bins are not locked by synchronizing on their first node, as the JDK map does. RegionEntries
+ * are synchronized on by region operations that also update the map. Instead, bins share a fixed
+ * set of {@link StampedLock}s by their index. There are at least four times as many locks as
+ * processors.
+ *
+ * <p>
+ * The next entry links of the nodes are plain fields, since the same RegionEntry classes are the
+ * nodes of {@link CustomEntryConcurrentHashMap}, which reads them under its segment locks. Writes
+ * to a chain are only made while holding the write lock of its bin, and a node put into an empty
+ * bin is published by the compare-and-set of the bin. A read traverses a chain in the optimistic
+ * read mode of the bin's lock and only trusts what it found if the lock validates afterwards.
+ * Otherwise a write overlapped with it, the links it followed may have been inconsistent, and it
+ * reads the bin again under the read lock.
+ *
+ * <p>
+ * The {@link MapCallback} operations of {@link CustomEntryConcurrentHashMap} are supported with the
+ * lock of the key's bin in place of the lock of its segment. Region maps use this map instead of
+ * {@link CustomEntryConcurrentHashMap} if {@link #ENABLED_PROPERTY} is set to true.
+ *
+ * @param <K> the type of keys maintained by this map
+ * @param <V> the type of mapped values
+ */
+public class CustomEntryBinnedConcurrentHashMap<K, V> extends AbstractMap<K, V>
+    implements ConcurrentMapWithReusableEntries<K, V> {
+
+  /**
+   * Region maps use a {@link CustomEntryBinnedConcurrentHashMap} if this is set to true.
+   */
+  public static final String ENABLED_PROPERTY =
+      GeodeGlossary.GEMFIRE_PREFIX + "BINNED_REGION_ENTRY_MAP";
+
+  /**
+   * The largest possible table capacity. This value must be exactly 1<<30 to stay within Java array
+   * allocation and indexing bounds for power of two table sizes.
+   */
+  private static final int MAXIMUM_CAPACITY = 1 << 30;
+
+  /**
+   * The default initial table capacity. Must be a power of 2.
+   */
+  private static final int DEFAULT_CAPACITY = 16;
+
+  /**
+   * The maximum number of bin locks.
+   */
+  private static final int MAXIMUM_LOCKS = 1 << 16;
+
+  /**
+   * Minimum number of rebinnings per transfer step. Ranges are subdivided to allow multiple resizer
+   * threads. This value serves as a lower bound to avoid resizers encountering excessive memory
+   * contention.
+   */
+  private static final int MIN_TRANSFER_STRIDE = 16;
+
+  /**
+   * The number of bits used for generation stamp in sizeCtl.
+   */
+  private static final int RESIZE_STAMP_BITS = 16;
+
+  /**
+   * The maximum number of threads that can help resize.
+   */
+  private static final int MAX_RESIZERS = (1 << (32 - RESIZE_STAMP_BITS)) - 1;
+
+  /**
+   * The bit shift for recording size stamp in sizeCtl.
+   */
+  private static final int RESIZE_STAMP_SHIFT = 32 - RESIZE_STAMP_BITS;
+
+  private static final int NCPU = Runtime.getRuntime().availableProcessors();
+
+  /**
+   * The number of nodes a read traverses without its lock before it checks that no write to the
+   * bin has started, since a chain that is relinked while it is traversed can appear to loop.
+   */
+  private static final int OPTIMISTIC_READ_CHECK_INTERVAL = 64;
+
+  @SuppressWarnings("rawtypes")
+  private static final AtomicIntegerFieldUpdater<CustomEntryBinnedConcurrentHashMap> SIZE_CTL =
+      AtomicIntegerFieldUpdater.newUpdater(CustomEntryBinnedConcurrentHashMap.class, "sizeCtl");
+
+  @SuppressWarnings("rawtypes")
+  private static final AtomicIntegerFieldUpdater<CustomEntryBinnedConcurrentHashMap>
+      TRANSFER_INDEX = AtomicIntegerFieldUpdater
+          .newUpdater(CustomEntryBinnedConcurrentHashMap.class, "transferIndex");
+
+  /**
+   * The array of bins. Lazily initialized upon first insertion. Size is always a power of two.
+   */
+  private volatile AtomicReferenceArray<HashEntry<K, V>> table;
+
+  /**
+   * The next table to use; non-null only while resizing.
+   */
+  private volatile AtomicReferenceArray<HashEntry<K, V>> nextTable;
+
+  /**
+   * Table initialization and resizing control. When negative, the table is being initialized or
+   * resized: -1 for initialization, else -(1 + the number of active resizing threads). Otherwise,
+   * when table is null, holds the initial table size to use upon creation, or 0 for default. After
+   * initialization, holds the next element count value upon which to resize the table.
+   */
+  @SuppressWarnings("unused")
+  private volatile int sizeCtl;
+
+  /**
+   * The next table index (plus one) to split while resizing.
+   */
+  @SuppressWarnings("unused")
+  private volatile int transferIndex;
+
+  private final LongAdder count = new LongAdder();
+
+  /**
+   * The locks of the bins. A bin is locked by the lock at its index modulo the number of locks.
+   */
+  private final StampedLock[] locks;
+
+  private final float loadFactor;
+
+  /**
+   * {@link HashEntryCreator} for the map to create {@link HashEntry}s.
+   */
+  private final HashEntryCreator<K, V> entryCreator;
+
+  /**
+   * If true then use equals for comparing key and value equality else use reference-equality like
+   * an {@link java.util.IdentityHashMap}.
+   */
+  private final boolean compareValues;
+
+  private transient Set<K> keySet;
+  private transient Collection<V> values;
+  private transient Set<Map.Entry<K, V>> entrySet;
+  private transient Set<Map.Entry<K, V>> reusableEntrySet;
+
+  /**
+   * Creates a new, empty map with the specified initial capacity, load factor, concurrency level
+   * and custom {@link HashEntryCreator}.
+   *
+   * @param initialCapacity the initial capacity. The implementation performs internal sizing to
+   *        accommodate this many elements.
+   * @param loadFactor the load factor threshold, used to control resizing. Resizing may be
+   *        performed when the average number of elements per bin exceeds this threshold.
+   * @param concurrencyLevel the estimated number of concurrently updating threads. The map has at
+   *        least this many bin locks.
+   * @param isIdentityMap if true then this will use reference-equality instead of equals like an
+   *        {@link java.util.IdentityHashMap}
+   * @param entryCreator a custom {@link HashEntryCreator} for creating the map entries, or null to
+   *        use the default entries
+   *
+   * @throws IllegalArgumentException if the initial capacity is negative or the load factor or
+   *         concurrencyLevel are nonpositive.
+   */
+  public CustomEntryBinnedConcurrentHashMap(final int initialCapacity, final float loadFactor,
+      final int concurrencyLevel, final boolean isIdentityMap,
+      final HashEntryCreator<K, V> entryCreator) {
+    if (!(loadFactor > 0) || initialCapacity < 0 || concurrencyLevel <= 0) {
+      throw new IllegalArgumentException();
+    }
+    final long size = (long) (1.0 + initialCapacity / loadFactor);
+    this.sizeCtl =
+        (size >= (long) MAXIMUM_CAPACITY) ? MAXIMUM_CAPACITY : tableSizeFor((int) size);
+    this.loadFactor = loadFactor;
+    this.locks = new StampedLock[Math.min(
+        tableSizeFor(Math.max(concurrencyLevel, NCPU << 2)), MAXIMUM_LOCKS)];
+    for (int i = 0; i < this.locks.length; i++) {
+      this.locks[i] = new StampedLock();
+    }
+    this.compareValues = !isIdentityMap;
+    this.entryCreator = entryCreator != null ? entryCreator
+        : new CustomEntryConcurrentHashMap.DefaultHashEntryCreator<>();
+  }
+
+  /**
+   * Creates a new, empty map with the default initial capacity (16), load factor (0.75) and
+   * concurrency level (16).
+   */
+  public CustomEntryBinnedConcurrentHashMap() {
+    this(DEFAULT_CAPACITY, CustomEntryConcurrentHashMap.DEFAULT_LOAD_FACTOR,
+        CustomEntryConcurrentHashMap.DEFAULT_CONCURRENCY_LEVEL, false, null);
+  }
+
+  /* ---------------- Small Utilities -------------- */
+
+  /**
+   * Returns a power of two table size for the given desired capacity.
+   */
+  private static int tableSizeFor(final int c) {
+    int n = c - 1;
+    n |= n >>> 1;
+    n |= n >>> 2;
+    n |= n >>> 4;
+    n |= n >>> 8;
+    n |= n >>> 16;
+    return (n < 0) ? 1 : (n >= MAXIMUM_CAPACITY) ? MAXIMUM_CAPACITY : n + 1;
+  }
+
+  /**
+   * Returns the stamp bits for resizing a table of size n. Must be negative when shifted left by
+   * RESIZE_STAMP_SHIFT.
+   */
+  private static int resizeStamp(final int n) {
+    return Integer.numberOfLeadingZeros(n) | (1 << (RESIZE_STAMP_BITS - 1));
+  }
+
+  private int threshold(final int n) {
+    return n >= MAXIMUM_CAPACITY ? Integer.MAX_VALUE : (int) (n * this.loadFactor);
+  }
+
+  private int hash(final Object key) {
+    // throws NullPointerException if key null
+    return this.entryCreator.keyHashCode(key, this.compareValues);
+  }
+
+  private boolean keyEquals(final Object key, final HashEntry<K, V> e) {
+    return this.compareValues ? e.isKeyEqual(key) : key == e.getKey();
+  }
+
+  private boolean valueEquals(final Object value, final Object mapValue) {
+    return value == mapValue || (this.compareValues && value.equals(mapValue));
+  }
+
+  /**
+   * Returns the lock of the bin at the given index of a table.
+   */
+  private StampedLock lockFor(final int index) {
+    return this.locks[index & (this.locks.length - 1)];
+  }
+
+  /**
+   * Waits until the transfer of the bin at the given index of a table to the next table has
+   * completed. The bin is marked as moved before its nodes are relinked into the next table, and
+   * both are done while holding the lock of the bin.
+   */
+  private void awaitTransfer(final int index) {
+    final StampedLock lock = lockFor(index);
+    // nothing to do, the transfer released the lock when it was done
+    lock.unlockRead(lock.readLock());
+  }
+
+  /**
+   * Returns the node for the given key in the chain starting at the given node, or null if there
+   * is none. If a lock is given, the chain is traversed in the optimistic read mode of the lock
+   * with the given stamp, and the result is only valid if the stamp validates afterwards.
+   */
+  private HashEntry<K, V> findInBin(HashEntry<K, V> e, final Object key, final int hash,
+      final StampedLock lock, final long stamp) {
+    for (int steps = 1; e != null; e = e.getNextEntry(), steps++) {
+      if (e.getEntryHash() == hash && keyEquals(key, e)) {
+        return e;
+      }
+      if (lock != null && steps % OPTIMISTIC_READ_CHECK_INTERVAL == 0 && !lock.validate(stamp)) {
+        return null;
+      }
+    }
+    return null;
+  }
+
+  /* ---------------- Nodes -------------- */
+
+  /**
+   * A node placed in a bin whose nodes are being or have been moved to the next table.
+   */
+  static final class ForwardingNode<K, V> implements HashEntry<K, V> {
+
+    final AtomicReferenceArray<HashEntry<K, V>> nextTable;
+
+    ForwardingNode(final AtomicReferenceArray<HashEntry<K, V>> nextTable) {
+      this.nextTable = nextTable;
+    }
+
+    @Override
+    public K getKey() {
+      return null;
+    }
+
+    @Override
+    public boolean isKeyEqual(final Object k) {
+      return false;
+    }
+
+    @Override
+    public V getMapValue() {
+      return null;
+    }
+
+    @Override
+    public void setMapValue(final V newValue) {
+      throw new UnsupportedOperationException();
+    }
+
+    @Override
+    public int getEntryHash() {
+      return 0;
+    }
+
+    @Override
+    public HashEntry<K, V> getNextEntry() {
+      return null;
+    }
+
+    @Override
+    public void setNextEntry(final HashEntry<K, V> n) {
+      throw new UnsupportedOperationException();
+    }
+  }
+
+  /* ---------------- Table Initialization and Resizing -------------- */
+
+  /**
+   * Initializes table, using the size recorded in sizeCtl.
+   */
+  private AtomicReferenceArray<HashEntry<K, V>> initTable() {
+    AtomicReferenceArray<HashEntry<K, V>> tab;
+    int sc;
+    while ((tab = this.table) == null) {
+      if ((sc = this.sizeCtl) < 0) {
+        Thread.yield(); // lost initialization race; just spin
+      } else if (SIZE_CTL.compareAndSet(this, sc, -1)) {
+        try {
+          if ((tab = this.table) == null) {
+            final int n = (sc > 0) ? sc : DEFAULT_CAPACITY;
+            tab = new AtomicReferenceArray<>(n);
+            this.table = tab;
+            sc = threshold(n);
+          }
+        } finally {
+          this.sizeCtl = sc;
+        }
+        break;
+      }
+    }
+    return tab;
+  }
+
+  /**
+   * Adds to count, and if table is too small and not already resizing, initiates transfer. If
+   * already resizing, helps perform transfer if work is available. Rechecks occupancy after a
+   * transfer to see if another resize is already needed because resizings are lagging additions.
+   *
+   * @param x the count to add
+   * @param check if negative, don't check resize
+   */
+  private void addCount(final long x, final int check) {
+    this.count.add(x);
+    if (check < 0) {
+      return;
+    }
+    AtomicReferenceArray<HashEntry<K, V>> tab;
+    AtomicReferenceArray<HashEntry<K, V>> nt;
+    int n;
+    int sc;
+    long s = this.count.sum();
+    while (s >= (long) (sc = this.sizeCtl) && (tab = this.table) != null
+        && (n = tab.length()) < MAXIMUM_CAPACITY) {
+      final int rs = resizeStamp(n) << RESIZE_STAMP_SHIFT;
+      if (sc < 0) {
+        if (sc == rs + MAX_RESIZERS || sc == rs + 1 || (nt = this.nextTable) == null
+            || this.transferIndex <= 0) {
+          break;
+        }
+        if (SIZE_CTL.compareAndSet(this, sc, sc + 1)) {
+          transfer(tab, nt);
+        }
+      } else if (SIZE_CTL.compareAndSet(this, sc, rs + 2)) {
+        transfer(tab, null);
+      }
+      s = this.count.sum();
+    }
+  }
+
+  /**
+   * Helps transfer if a resize is in progress, after waiting for the transfer of the bin at the
+   * given index, which has been marked as moved.
+   */
+  private AtomicReferenceArray<HashEntry<K, V>> helpTransfer(
+      final AtomicReferenceArray<HashEntry<K, V>> tab, final ForwardingNode<K, V> f,
+      final int index) {
+    awaitTransfer(index);
+    final AtomicReferenceArray<HashEntry<K, V>> nextTab = f.nextTable;
+    final int rs = resizeStamp(tab.length()) << RESIZE_STAMP_SHIFT;
+    int sc;
+    while (nextTab == this.nextTable && this.table == tab && (sc = this.sizeCtl) < 0) {
+      if (sc == rs + MAX_RESIZERS || sc == rs + 1 || this.transferIndex <= 0) {
+        break;
+      }
+      if (SIZE_CTL.compareAndSet(this, sc, sc + 1)) {
+        transfer(tab, nextTab);
+        break;
+      }
+    }
+    return nextTab;
+  }
+
+  /**
+   * Moves and relinks the nodes in each bin to the new table.
+   */
+  private void transfer(final AtomicReferenceArray<HashEntry<K, V>> tab,
+      AtomicReferenceArray<HashEntry<K, V>> nextTab) {
+    final int n = tab.length();
+    int stride;
+    if ((stride = (NCPU > 1) ? (n >>> 3) / NCPU : n) < MIN_TRANSFER_STRIDE) {
+      stride = MIN_TRANSFER_STRIDE; // subdivide range
+    }
+    if (nextTab == null) { // initiating
+      try {
+        nextTab = new AtomicReferenceArray<>(n << 1);
+      } catch (OutOfMemoryError ex) {
+        this.sizeCtl = Integer.MAX_VALUE;
+        return;
+      }
+      this.nextTable = nextTab;
+      this.transferIndex = n;
+    }
+    final int nextn = nextTab.length();
+    final ForwardingNode<K, V> fwd = new ForwardingNode<>(nextTab);
+    boolean advance = true;
+    boolean finishing = false; // to ensure sweep before committing nextTab
+    for (int i = 0, bound = 0;;) {
+      HashEntry<K, V> f;
+      while (advance) {
+        int nextIndex;
+        int nextBound;
+        if (--i >= bound || finishing) {
+          advance = false;
+        } else if ((nextIndex = this.transferIndex) <= 0) {
+          i = -1;
+          advance = false;
+        } else if (TRANSFER_INDEX.compareAndSet(this, nextIndex,
+            nextBound = (nextIndex > stride ? nextIndex - stride : 0))) {
+          bound = nextBound;
+          i = nextIndex - 1;
+          advance = false;
+        }
+      }
+      if (i < 0 || i >= n || i + n >= nextn) {
+        int sc;
+        if (finishing) {
+          this.nextTable = null;
+          this.table = nextTab;
+          this.sizeCtl = threshold(nextn);
+          return;
+        }
+        if (SIZE_CTL.compareAndSet(this, sc = this.sizeCtl, sc - 1)) {
+          if ((sc - 2) != resizeStamp(n) << RESIZE_STAMP_SHIFT) {
+            return;
+          }
+          finishing = advance = true;
+          i = n; // recheck before commit
+        }
+      } else if ((f = tab.get(i)) == null) {
+        advance = tab.compareAndSet(i, null, fwd);
+      } else if (f instanceof ForwardingNode) {
+        advance = true; // already processed
+      } else {
+        final StampedLock lock = lockFor(i);
+        final long stamp = lock.writeLock();
+        try {
+          if (tab.get(i) == f) {
+            // Mark the bin as moved before relinking its nodes, so that a read that traverses the
+            // bin while it is relinked and misses its key can tell that it has to look again.
+            tab.set(i, fwd);
+            int runBit = f.getEntryHash() & n;
+            HashEntry<K, V> lastRun = f;
+            for (HashEntry<K, V> p = f.getNextEntry(); p != null; p = p.getNextEntry()) {
+              final int b = p.getEntryHash() & n;
+              if (b != runBit) {
+                runBit = b;
+                lastRun = p;
+              }
+            }
+            HashEntry<K, V> ln;
+            HashEntry<K, V> hn;
+            if (runBit == 0) {
+              ln = lastRun;
+              hn = null;
+            } else {
+              hn = lastRun;
+              ln = null;
+            }
+            HashEntry<K, V> next;
+            for (HashEntry<K, V> p = f; p != lastRun; p = next) {
+              next = p.getNextEntry();
+              if ((p.getEntryHash() & n) == 0) {
+                p.setNextEntry(ln);
+                ln = p;
+              } else {
+                p.setNextEntry(hn);
+                hn = p;
+              }
+            }
+            nextTab.set(i, ln);
+            nextTab.set(i + n, hn);
+            advance = true;
+          }
+        } finally {
+          lock.unlockWrite(stamp);
+        }
+      }
+    }
+  }
+
+  /* ---------------- Map operations -------------- */
+
+  /**
+   * Returns the node for the given key, or null if there is none.
+   */
+  private HashEntry<K, V> getEntry(final Object key, final int hash) {
+    AtomicReferenceArray<HashEntry<K, V>> tab = this.table;
+    while (tab != null) {
+      final int i = hash & (tab.length() - 1);
+      final StampedLock lock = lockFor(i);
+      HashEntry<K, V> f;
+      final long stamp = lock.tryOptimisticRead();
+      if (stamp != 0L) {
+        f = tab.get(i);
+        final HashEntry<K, V> e =
+            f instanceof ForwardingNode ? null : findInBin(f, key, hash, lock, stamp);
+        if (lock.validate(stamp)) {
+          if (!(f instanceof ForwardingNode)) {
+            return e;
+          }
+          // the move of the bin has completed, search the next table
+          tab = ((ForwardingNode<K, V>) f).nextTable;
+          continue;
+        }
+      }
+      // a write to the bin overlapped with the read, read it again under its lock
+      final long readStamp = lock.readLock();
+      try {
+        f = tab.get(i);
+        if (!(f instanceof ForwardingNode)) {
+          return findInBin(f, key, hash, null, 0L);
+        }
+      } finally {
+        lock.unlockRead(readStamp);
+      }
+      tab = ((ForwardingNode<K, V>) f).nextTable;
+    }
+    return null;
+  }
+
+  /**
+   * Returns the value to which the specified key is mapped, or {@code null} if this map contains no
+   * mapping for the key.
+   *
+   * @throws NullPointerException if the specified key is null
+   */
+  @Override
+  public V get(final Object key) {
+    return getMapValue(getEntry(key, hash(key)));
+  }
+
+  /**
+   * Tests if the specified object is a key in this table.
+   *
+   * @throws NullPointerException if the specified key is null
+   */
+  @Override
+  public boolean containsKey(final Object key) {
+    return getEntry(key, hash(key)) != null;
+  }
+
+  /**
+   * Returns <tt>true</tt> if this map maps one or more keys to the specified value. Note: This
+   * method requires a full internal traversal of the hash table, and so is much slower than method
+   * <tt>containsKey</tt>.
+   *
+   * @throws NullPointerException if the specified value is null
+   */
+  @Override
+  public boolean containsValue(final Object value) {
+    if (value == null) {
+      throw new NullPointerException();
+    }
+    for (final BinIterator it = new BinIterator(); it.hasNext();) {
+      if (valueEquals(value, it.nextEntry().getMapValue())) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  @Override
+  public int size() {
+    final long n = this.count.sum();
+    return (n < 0L) ? 0 : (n > (long) Integer.MAX_VALUE) ? Integer.MAX_VALUE : (int) n;
+  }
+
+  @Override
+  public boolean isEmpty() {
+    return this.count.sum() <= 0L;
+  }
+
+  /**
+   * Maps the specified key to the specified value in this table. Neither the key nor the value can
+   * be null.
+   *
+   * @return the previous value associated with <tt>key</tt>, or <tt>null</tt> if there was no
+   *         mapping for <tt>key</tt>
+   * @throws NullPointerException if the specified key or value is null
+   */
+  @Override
+  public V put(final K key, final V value) {
+    return putVal(key, value, false);
+  }
+
+  /**
+   * {@inheritDoc}
+   *
+   * @return the previous value associated with the specified key, or <tt>null</tt> if there was no
+   *         mapping for the key
+   * @throws NullPointerException if the specified key or value is null
+   */
+  @Override
+  public V putIfAbsent(final K key, final V value) {
+    return putVal(key, value, true);
+  }
+
+  private V putVal(final K key, final V value, final boolean onlyIfAbsent) {
+    if (value == null) {
+      throw new NullPointerException();
+    }
+    final int hash = hash(key);
+    int binCount = 0;
+    for (AtomicReferenceArray<HashEntry<K, V>> tab = this.table;;) {
+      final HashEntry<K, V> f;
+      final int i;
+      if (tab == null) {
+        tab = initTable();
+      } else if ((f = tab.get(i = hash & (tab.length() - 1))) == null) {
+        if (tab.compareAndSet(i, null, this.entryCreator.newEntry(key, hash, null, value))) {
+          break; // no lock when adding to empty bin
+        }
+      } else if (f instanceof ForwardingNode) {
+        tab = helpTransfer(tab, (ForwardingNode<K, V>) f, i);
+      } else {
+        V oldVal = null;
+        final StampedLock lock = lockFor(i);
+        final long stamp = lock.writeLock();
+        try {
+          if (tab.get(i) == f) {
+            binCount = 1;
+            for (HashEntry<K, V> e = f;; ++binCount) {
+              if (e.getEntryHash() == hash && keyEquals(key, e)) {
+                oldVal = e.getMapValue();
+                if (!onlyIfAbsent) {
+                  e.setMapValue(value);
+                }
+                break;
+              }
+              final HashEntry<K, V> next = e.getNextEntry();
+              if (next == null) {
+                e.setNextEntry(this.entryCreator.newEntry(key, hash, null, value));
+                break;
+              }
+              e = next;
+            }
+          }
+        } finally {
+          lock.unlockWrite(stamp);
+        }
+        if (binCount != 0) {
+          if (oldVal != null) {
+            return oldVal;
+          }
+          break;
+        }
+      }
+    }
+    addCount(1L, binCount);
+    return null;
+  }
+
+  /**
+   * Implementation for the four public remove/replace methods: Replaces node value with v,
+   * conditional upon match of cv if non-null. If resulting value is null, delete.
+   */
+  private V replaceNode(final Object key, final V value, final Object cv) {
+    return replaceNode(key, value, cv, null, null, null);
+  }
+
+  /**
+   * Like {@link #replaceNode(Object, Object, Object)}, and also conditional upon the
+   * {@link MapCallback#doRemoveValue} of the given condition if it is non-null, which is invoked
+   * while holding the lock of the bin.
+   */
+  private <C, P> V replaceNode(final Object key, final V value, final Object cv,
+      final MapCallback<K, V, C, P> condition, final C context, final P params) {
+    final int hash = hash(key);
+    for (AtomicReferenceArray<HashEntry<K, V>> tab = this.table;;) {
+      final HashEntry<K, V> f;
+      final int i;
+      if (tab == null || (f = tab.get(i = hash & (tab.length() - 1))) == null) {
+        break;
+      } else if (f instanceof ForwardingNode) {
+        tab = helpTransfer(tab, (ForwardingNode<K, V>) f, i);
+      } else {
+        V oldVal = null;
+        boolean validated = false;
+        final StampedLock lock = lockFor(i);
+        final long stamp = lock.writeLock();
+        try {
+          if (tab.get(i) == f) {
+            validated = true;
+            for (HashEntry<K, V> e = f, pred = null; e != null; pred = e, e = e.getNextEntry()) {
+              if (e.getEntryHash() == hash && keyEquals(key, e)) {
+                final V ev = e.getMapValue();
+                if ((cv == null || valueEquals(cv, ev))
+                    && (condition == null || condition.doRemoveValue(ev, context, params))) {
+                  oldVal = ev;
+                  if (value != null) {
+                    e.setMapValue(value);
+                  } else if (pred != null) {
+                    // the removed node keeps its next entry for readers that are traversing it
+                    pred.setNextEntry(e.getNextEntry());
+                  } else {
+                    tab.set(i, e.getNextEntry());
+                  }
+                }
+                break;
+              }
+            }
+          }
+        } finally {
+          lock.unlockWrite(stamp);
+        }
+        if (validated) {
+          if (oldVal != null) {
+            if (value == null) {
+              addCount(-1L, -1);
+              // a removed region entry is never added back so it does not need its key anymore
+              OffHeapRegionEntryHelper.releaseKeyOfRemovedEntry(oldVal);
+            }
+            return oldVal;
+          }
+          break;
+        }
+      }
+    }
+    return null;
+  }
+
+  /**
+   * Removes the key (and its corresponding value) from this map. This method does nothing if the
+   * key is not in the map.
+   *
+   * @throws NullPointerException if the specified key is null
+   */
+  @Override
+  public V remove(final Object key) {
+    return replaceNode(key, null, null);
+  }
+
+  /**
+   * {@inheritDoc}
+   *
+   * @throws NullPointerException if the specified key is null
+   */
+  @Override
+  public boolean remove(final Object key, final Object value) {
+    if (key == null) {
+      throw new NullPointerException();
+    }
+    return value != null && replaceNode(key, null, value) != null;
+  }
+
+  /**
+   * {@inheritDoc}
+   *
+   * @throws NullPointerException if any of the arguments are null
+   */
+  @Override
+  public boolean replace(final K key, final V oldValue, final V newValue) {
+    if (key == null || oldValue == null || newValue == null) {
+      throw new NullPointerException();
+    }
+    return replaceNode(key, newValue, oldValue) != null;
+  }
+
+  /**
+   * {@inheritDoc}
+   *
+   * @return the previous value associated with the specified key, or <tt>null</tt> if there was no
+   *         mapping for the key
+   * @throws NullPointerException if the specified key or value is null
+   */
+  @Override
+  public V replace(final K key, final V value) {
+    if (key == null || value == null) {
+      throw new NullPointerException();
+    }
+    return replaceNode(key, value, null);
+  }
+
+  // Geode additions
+
+  /**
+   * Creates a mapping for the key only if there is none. The difference from
+   * {@link #putIfAbsent(Object, Object)} is that this does not lock if there is a mapping.
+   *
+   * @return true if the key was put in the map or false if there was a mapping for it
+   *
+   * @throws NullPointerException if the specified key or value is null
+   */
+  public boolean create(final K key, final V value) {
+    if (getEntry(key, hash(key)) != null) {
+      return false;
+    }
+    return putVal(key, value, true) == null;
+  }
+
+  /**
+   * Like {@link #putIfAbsent(Object, Object)} but creates the value only if there is no mapping
+   * for the key, rather than requiring a value that may be thrown away.
+   *
+   * @param key key with which the value is to be associated
+   * @param valueCreator creates the value with {@link MapCallback#newValue} while holding the lock
+   *        of the key's bin
+   * @param context passed to {@link MapCallback#newValue}
+   * @param createParams passed to {@link MapCallback#newValue}
+   * @param lockForRead if true, a mapping for the key is read while holding the read lock of its
+   *        bin and passed to {@link MapCallback#oldValueRead} in the lock
+   *
+   * @return the value associated with the key, or the new value if there was none
+   *
+   * @throws NullPointerException if the specified key or the created value is null
+   * @see CustomEntryConcurrentHashMap#create(Object, MapCallback, Object, Object, boolean)
+   */
+  public <C, P> V create(final K key, final MapCallback<K, V, C, P> valueCreator, final C context,
+      final P createParams, final boolean lockForRead) {
+    final int hash = hash(key);
+    final V existing =
+        lockForRead ? getLocked(key, hash, valueCreator) : getMapValue(getEntry(key, hash));
+    if (existing != null) {
+      return existing;
+    }
+    // the value is kept if the bin has to be looked up again, so it is created at most once
+    V created = null;
+    int binCount = 0;
+    for (AtomicReferenceArray<HashEntry<K, V>> tab = this.table;;) {
+      final HashEntry<K, V> f;
+      final int i;
+      if (tab == null) {
+        tab = initTable();
+      } else if ((f = tab.get(i = hash & (tab.length() - 1))) instanceof ForwardingNode) {
+        tab = helpTransfer(tab, (ForwardingNode<K, V>) f, i);
+      } else {
+        boolean added = false;
+        final StampedLock lock = lockFor(i);
+        final long stamp = lock.writeLock();
+        try {
+          // only a node put into an empty bin is added without the lock
+          final HashEntry<K, V> first = tab.get(i);
+          if (!(first instanceof ForwardingNode)) {
+            final HashEntry<K, V> e = findInBin(first, key, hash, null, 0L);
+            if (e != null) {
+              final V v = e.getMapValue();
+              if (lockForRead) {
+                valueCreator.oldValueRead(v);
+              }
+              return v;
+            }
+            if (created == null) {
+              created = valueCreator.newValue(key, context, createParams);
+              if (created == null) {
+                throw new NullPointerException();
+              }
+            }
+            final HashEntry<K, V> node = this.entryCreator.newEntry(key, hash, null, created);
+            if (first == null) {
+              added = tab.compareAndSet(i, null, node);
+            } else {
+              binCount = 1;
+              HashEntry<K, V> last = first;
+              for (HashEntry<K, V> next; (next = last.getNextEntry()) != null; last = next) {
+                binCount++;
+              }
+              last.setNextEntry(node);
+              added = true;
+            }
+          }
+        } finally {
+          lock.unlockWrite(stamp);
+        }
+        if (added) {
+          break;
+        }
+      }
+    }
+    addCount(1L, binCount);
+    return created;
+  }
+
+  /**
+   * Returns the value to which the key is mapped, or null if there is none. The value is read
+   * while holding the read lock of the key's bin, and if the given callback is non-null its
+   * {@link MapCallback#oldValueRead} is invoked in the lock.
+   *
+   * @throws NullPointerException if the specified key is null
+   * @see CustomEntryConcurrentHashMap#get(Object, MapCallback)
+   */
+  public V get(final Object key, final MapCallback<K, V, ?, ?> readCallback) {
+    return getLocked(key, hash(key), readCallback);
+  }
+
+  /**
+   * Removes the mapping for the key only if {@link MapCallback#doRemoveValue} of the given
+   * condition, which is invoked while holding the lock of the key's bin, returns true.
+   *
+   * @return the previous value associated with the key, or null if there was no mapping for the
+   *         key or it was not removed
+   *
+   * @throws NullPointerException if the specified key is null
+   * @see CustomEntryConcurrentHashMap#removeConditionally(Object, MapCallback, Object, Object)
+   */
+  public <C, P> V removeConditionally(final Object key, final MapCallback<K, V, C, P> condition,
+      final C context, final P removeParams) {
+    return replaceNode(key, null, null, condition, context, removeParams);
+  }
+
+  // End Geode additions
+
+  private V getMapValue(final HashEntry<K, V> e) {
+    return e != null ? e.getMapValue() : null;
+  }
+
+  /**
+   * Returns the value for the key, read while holding the read lock of its bin. If there is one
+   * and the given callback is non-null, its {@link MapCallback#oldValueRead} is invoked in the lock.
+   */
+  private V getLocked(final Object key, final int hash,
+      final MapCallback<K, V, ?, ?> readCallback) {
+    AtomicReferenceArray<HashEntry<K, V>> tab = this.table;
+    while (tab != null) {
+      final int i = hash & (tab.length() - 1);
+      final StampedLock lock = lockFor(i);
+      final HashEntry<K, V> f;
+      final long stamp = lock.readLock();
+      try {
+        f = tab.get(i);
+        if (!(f instanceof ForwardingNode)) {
+          final V v = getMapValue(findInBin(f, key, hash, null, 0L));
+          if (v != null && readCallback != null) {
+            readCallback.oldValueRead(v);
+          }
+          return v;
+        }
+      } finally {
+        lock.unlockRead(stamp);
+      }
+      tab = ((ForwardingNode<K, V>) f).nextTable;
+    }
+    return null;
+  }
+
+  @Override
+  public void clearWithExecutor(final Executor executor) {
+    ArrayList<HashEntry<?, ?>> clearedEntries = null;
+    boolean checkedForOffHeap = false;
+    if (OffHeapRegionEntryHelper.doesClearNeedToCheckForOffHeap()) {
+      clearedEntries = new ArrayList<>();
+      checkedForOffHeap = true;
+    }
+    long delta = 0L; // negative number of deletions
+    try {
+      int i = 0;
+      AtomicReferenceArray<HashEntry<K, V>> tab = this.table;
+      while (tab != null && i < tab.length()) {
+        final HashEntry<K, V> f = tab.get(i);
+        if (f == null) {
+          ++i;
+        } else if (f instanceof ForwardingNode) {
+          tab = helpTransfer(tab, (ForwardingNode<K, V>) f, i);
+          i = 0; // restart
+        } else {
+          final StampedLock lock = lockFor(i);
+          final long stamp = lock.writeLock();
+          try {
+            if (tab.get(i) == f) {
+              if (!checkedForOffHeap) {
+                // see if we have a map with off-heap region entries
+                checkedForOffHeap = true;
+                if (f instanceof OffHeapRegionEntry) {
+                  clearedEntries = new ArrayList<>();
+                }
+              }
+              for (HashEntry<K, V> p = f; p != null; p = p.getNextEntry()) {
+                --delta;
+              }
+              tab.set(i++, null);
+              if (clearedEntries != null) {
+                clearedEntries.add(f);
+              }
+            }
+          } finally {
+            lock.unlockWrite(stamp);
+          }
+        }
+      }
+    } finally {
+      if (delta != 0L) {
+        addCount(delta, -1);
+      }
+      if (clearedEntries != null && !clearedEntries.isEmpty()) {
+        CustomEntryConcurrentHashMap.releaseClearedEntries(clearedEntries, executor, this);
+      }
+    }
+  }
+
+  /**
+   * Removes all of the mappings from this map.
+   */
+  @Override
+  public void clear() {
+    clearWithExecutor(null);
+  }
+
+  /**
+   * Returns a {@link Set} view of the keys contained in this map. The view's iterator is weakly
+   * consistent.
+   */
+  @Override
+  public Set<K> keySet() {
+    final Set<K> ks = this.keySet;
+    return (ks != null) ? ks : (this.keySet = new KeySet());
+  }
+
+  /**
+   * Returns a {@link Collection} view of the values contained in this map. The view's iterator is
+   * weakly consistent.
+   */
+  @Override
+  public Collection<V> values() {
+    final Collection<V> vs = this.values;
+    return (vs != null) ? vs : (this.values = new Values());
+  }
+
+  /**
+   * Returns a {@link Set} view of the mappings contained in this map. The view's iterator is weakly
+   * consistent.
+   */
+  @Override
+  public Set<Map.Entry<K, V>> entrySet() {
+    final Set<Map.Entry<K, V>> es = this.entrySet;
+    return (es != null) ? es : (this.entrySet = new EntrySet(false));
+  }
+
+  @Override
+  public Set<Map.Entry<K, V>> entrySetWithReusableEntries() {
+    final Set<Map.Entry<K, V>> es = this.reusableEntrySet;
+    return (es != null) ? es : (this.reusableEntrySet = new EntrySet(true));
+  }
+
+  /* ---------------- Iterator Support -------------- */
+
+  private static final class TableBin<K, V> {
+    final AtomicReferenceArray<HashEntry<K, V>> table;
+    final int index;
+
+    TableBin(final AtomicReferenceArray<HashEntry<K, V>> table, final int index) {
+      this.table = table;
+      this.index = index;
+    }
+  }
+
+  /**
+   * Iterates over the bins of the table. The nodes of a bin are copied before any of them is
+   * returned, so that a bin that is written to while it is copied can be copied again under its
+   * lock. A bin that has moved is read from the two bins of the next table it was split into.
+   */
+  class BinIterator {
+
+    private final AtomicReferenceArray<HashEntry<K, V>> baseTable;
+
+    private int baseIndex;
+
+    private final ArrayDeque<TableBin<K, V>> pendingBins = new ArrayDeque<>();
+
+    private final ArrayList<HashEntry<K, V>> currentBin = new ArrayList<>(5);
+
+    private int currentIndex;
+
+    private HashEntry<K, V> nextEntry;
+
+    private HashEntry<K, V> lastReturned;
+
+    BinIterator() {
+      this.baseTable = CustomEntryBinnedConcurrentHashMap.this.table;
+      advance();
+    }
+
+    private void advance() {
+      for (;;) {
+        if (this.currentIndex < this.currentBin.size()) {
+          this.nextEntry = this.currentBin.get(this.currentIndex++);
+          return;
+        }
+        this.currentBin.clear();
+        this.currentIndex = 0;
+        final TableBin<K, V> bin = this.pendingBins.pollFirst();
+        if (bin != null) {
+          readBin(bin.table, bin.index);
+        } else if (this.baseTable != null && this.baseIndex < this.baseTable.length()) {
+          readBin(this.baseTable, this.baseIndex++);
+        } else {
+          this.nextEntry = null;
+          return;
+        }
+      }
+    }
+
+    private void readBin(final AtomicReferenceArray<HashEntry<K, V>> tab, final int i) {
+      final StampedLock lock = lockFor(i);
+      HashEntry<K, V> f;
+      final long stamp = lock.tryOptimisticRead();
+      if (stamp != 0L) {
+        f = tab.get(i);
+        if (!(f instanceof ForwardingNode)) {
+          copyBin(f, lock, stamp);
+        }
+        if (lock.validate(stamp)) {
+          if (f instanceof ForwardingNode) {
+            readMovedBin(tab, i, (ForwardingNode<K, V>) f);
+          }
+          return;
+        }
+        this.currentBin.clear();
+      }
+      // a write to the bin overlapped with the copy, copy it again under its lock
+      final long readStamp = lock.readLock();
+      try {
+        f = tab.get(i);
+        if (!(f instanceof ForwardingNode)) {
+          copyBin(f, null, 0L);
+          return;
+        }
+      } finally {
+        lock.unlockRead(readStamp);
+      }
+      readMovedBin(tab, i, (ForwardingNode<K, V>) f);
+    }
+
+    /**
+     * Copies the nodes of the chain starting at the given node. If a lock is given, the chain is
+     * traversed in the optimistic read mode of the lock with the given stamp, and the copy is only
+     * valid if the stamp validates afterwards.
+     */
+    private void copyBin(final HashEntry<K, V> f, final StampedLock lock, final long stamp) {
+      int steps = 1;
+      for (HashEntry<K, V> e = f; e != null; e = e.getNextEntry(), steps++) {
+        this.currentBin.add(e);
+        if (lock != null && steps % OPTIMISTIC_READ_CHECK_INTERVAL == 0 && !lock.validate(stamp)) {
+          return;
+        }
+      }
+    }
+
+    /**
+     * Reads a bin that has moved from the two bins of the next table it was split into.
+     */
+    private void readMovedBin(final AtomicReferenceArray<HashEntry<K, V>> tab, final int i,
+        final ForwardingNode<K, V> f) {
+      this.pendingBins.addFirst(new TableBin<>(f.nextTable, i + tab.length()));
+      this.pendingBins.addFirst(new TableBin<>(f.nextTable, i));
+    }
+
+    public boolean hasNext() {
+      return this.nextEntry != null;
+    }
+
+    HashEntry<K, V> nextEntry() {
+      if (this.nextEntry == null) {
+        throw new NoSuchElementException();
+      }
+      this.lastReturned = this.nextEntry;
+      advance();
+      return this.lastReturned;
+    }
+
+    public void remove() {
+      if (this.lastReturned == null) {
+        throw new IllegalStateException();
+      }
+      CustomEntryBinnedConcurrentHashMap.this.remove(this.lastReturned.getKey());
+      this.lastReturned = null;
+    }
+  }
+
+  class KeyIterator extends BinIterator implements Iterator<K> {
+
+    @Override
+    public K next() {
+      return nextEntry().getKey();
+    }
+  }
+
+  class ValueIterator extends BinIterator implements Iterator<V> {
+
+    @Override
+    public V next() {
+      return nextEntry().getMapValue();
+    }
+  }
+
+  /**
+   * Entry returned by the entry set iterators, that relays setValue changes to the map. The entry
+   * set with reusable entries returns the same instance for every mapping.
+   */
+  class WriteThroughEntry implements Map.Entry<K, V> {
+
+    K key;
+
+    V value;
+
+    @Override
+    public K getKey() {
+      return this.key;
+    }
+
+    @Override
+    public V getValue() {
+      return this.value;
+    }
+
+    @Override
+    public V setValue(final V value) {
+      if (value == null) {
+        throw new NullPointerException();
+      }
+      final V v = this.value;
+      this.value = value;
+      CustomEntryBinnedConcurrentHashMap.this.put(this.key, value);
+      return v;
+    }
+
+    @Override
+    public boolean equals(final Object o) {
+      if (!(o instanceof Map.Entry<?, ?>)) {
+        return false;
+      }
+      final Map.Entry<?, ?> e = (Map.Entry<?, ?>) o;
+      if (CustomEntryBinnedConcurrentHashMap.this.compareValues) {
+        return this.key.equals(e.getKey()) && this.value.equals(e.getValue());
+      }
+      return this.key == e.getKey() && this.value == e.getValue();
+    }
+
+    @Override
+    public int hashCode() {
+      if (CustomEntryBinnedConcurrentHashMap.this.compareValues) {
+        return this.key.hashCode() ^ this.value.hashCode();
+      }
+      return System.identityHashCode(this.key) ^ System.identityHashCode(this.value);
+    }
+
+    @Override
+    public String toString() {
+      return this.key + "=" + this.value;
+    }
+  }
+
+  class EntryIterator extends BinIterator implements Iterator<Map.Entry<K, V>> {
+
+    private final WriteThroughEntry reusableEntry;
+
+    EntryIterator(final WriteThroughEntry reusableEntry) {
+      this.reusableEntry = reusableEntry;
+    }
+
+    @Override
+    public Map.Entry<K, V> next() {
+      final HashEntry<K, V> e = nextEntry();
+      final WriteThroughEntry entry =
+          this.reusableEntry != null ? this.reusableEntry : new WriteThroughEntry();
+      entry.key = e.getKey();
+      entry.value = e.getMapValue();
+      return entry;
+    }
+  }
+
+  class KeySet extends AbstractSet<K> {
+
+    @Override
+    public Iterator<K> iterator() {
+      return new KeyIterator();
+    }
+
+    @Override
+    public int size() {
+      return CustomEntryBinnedConcurrentHashMap.this.size();
+    }
+
+    @Override
+    public boolean contains(final Object o) {
+      return CustomEntryBinnedConcurrentHashMap.this.containsKey(o);
+    }
+
+    @Override
+    public boolean remove(final Object o) {
+      return CustomEntryBinnedConcurrentHashMap.this.remove(o) != null;
+    }
+
+    @Override
+    public void clear() {
+      CustomEntryBinnedConcurrentHashMap.this.clear();
+    }
+  }
+
+  class Values extends AbstractCollection<V> {
+
+    @Override
+    public Iterator<V> iterator() {
+      return new ValueIterator();
+    }
+
+    @Override
+    public int size() {
+      return CustomEntryBinnedConcurrentHashMap.this.size();
+    }
+
+    @Override
+    public boolean contains(final Object o) {
+      return CustomEntryBinnedConcurrentHashMap.this.containsValue(o);
+    }
+
+    @Override
+    public void clear() {
+      CustomEntryBinnedConcurrentHashMap.this.clear();
+    }
+  }
+
+  class EntrySet extends AbstractSet<Map.Entry<K, V>> {
+
+    private final boolean useReusableEntry;
+
+    EntrySet(final boolean useReusableEntry) {
+      this.useReusableEntry = useReusableEntry;
+    }
+
+    @Override
+    public Iterator<Map.Entry<K, V>> iterator() {
+      return new EntryIterator(this.useReusableEntry ? new WriteThroughEntry() : null);
+    }
+
+    @Override
+    public boolean contains(final Object o) {
+      if (!(o instanceof Map.Entry)) {
+        return false;
+      }
+      final Map.Entry<?, ?> e = (Map.Entry<?, ?>) o;
+      final V v = CustomEntryBinnedConcurrentHashMap.this.get(e.getKey());
+      return v != null && valueEquals(v, e.getValue());
+    }
+
+    @Override
+    public boolean remove(final Object o) {
+      if (!(o instanceof Map.Entry)) {
+        return false;
+      }
+      final Map.Entry<?, ?> e = (Map.Entry<?, ?>) o;
+      return CustomEntryBinnedConcurrentHashMap.this.remove(e.getKey(), e.getValue());
+    }
+
+    @Override
+    public int size() {
+      return CustomEntryBinnedConcurrentHashMap.this.size();
+    }
+
+    @Override
+    public void clear() {
+      CustomEntryBinnedConcurrentHashMap.this.clear();
+    }
+  }
+}
@@ -1712,7 +1712,18 @@ public class CustomEntryConcurrentHashMap<K, V> extends AbstractMap<K, V>
       final C context, final P removeParams) {
     // throws NullPointerException if key null
     final int hash = this.entryCreator.keyHashCode(key, this.compareValues);
-    return segmentFor(hash).remove(key, hash, NO_OBJECT_TOKEN, condition, context, removeParams);
+    return removed(
+        segmentFor(hash).remove(key, hash, NO_OBJECT_TOKEN, condition, context, removeParams));
+  }
+
+  /**
+   * Called with the value of every mapping that was removed from this map, or null. A region entry
+   * is never added back to the map once it is removed, so its off-heap key is released here
+   * instead of by every caller that removes it.
+   */
+  private V removed(final V oldValue) {
+    OffHeapRegionEntryHelper.releaseKeyOfRemovedEntry(oldValue);
+    return oldValue;
   }
 
   // End Geode addition
@@ -1743,7 +1754,7 @@ public class CustomEntryConcurrentHashMap<K, V> extends AbstractMap<K, V>
   public V remove(final Object key) {
     // throws NullPointerException if key null
     final int hash = this.entryCreator.keyHashCode(key, this.compareValues);
-    return segmentFor(hash).remove(key, hash, NO_OBJECT_TOKEN, null, null, null);
+    return removed(segmentFor(hash).remove(key, hash, NO_OBJECT_TOKEN, null, null, null));
   }
 
   /**
@@ -1758,7 +1769,7 @@ public class CustomEntryConcurrentHashMap<K, V> extends AbstractMap<K, V>
     }
     // throws NullPointerException if key null
     final int hash = this.entryCreator.keyHashCode(key, this.compareValues);
-    return segmentFor(hash).remove(key, hash, value, null, null, null) != null;
+    return removed(segmentFor(hash).remove(key, hash, value, null, null, null)) != null;
   }
 
   /**
@@ -1803,57 +1814,67 @@ public class CustomEntryConcurrentHashMap<K, V> extends AbstractMap<K, V>
       }
     } finally {
       if (entries != null) {
-        final ArrayList<HashEntry<?, ?>> clearedEntries = entries;
-        Runnable runnable;
-        if (OffHeapRegionEntryHelper.doesClearNeedToCheckForOffHeap()) {
-          runnable = new Runnable() {
-            @Override
-            public void run() {
-              for (HashEntry<?, ?> he : clearedEntries) {
-                for (HashEntry<?, ?> p = he; p != null; p = p.getNextEntry()) {
-                  if (p instanceof RegionEntry) {
-                    synchronized (p) {
-                      GatewaySenderEventImpl.release(((RegionEntry) p).getValue()); // OFFHEAP
-                    }
-                  }
+        releaseClearedEntries(entries, executor, this);
+      }
+    }
+  }
+
+  /**
+   * Releases the off-heap values of the chains of entries that a clear removed from a map, or the
+   * off-heap values that gateway sender events hold on to. This is done asynchronously using the
+   * given executor, or a new Thread if it is null or rejects the task.
+   */
+  static void releaseClearedEntries(final ArrayList<HashEntry<?, ?>> clearedEntries,
+      final Executor executor, final Object map) {
+    Runnable runnable;
+    if (OffHeapRegionEntryHelper.doesClearNeedToCheckForOffHeap()) {
+      runnable = new Runnable() {
+        @Override
+        public void run() {
+          for (HashEntry<?, ?> he : clearedEntries) {
+            for (HashEntry<?, ?> p = he; p != null; p = p.getNextEntry()) {
+              if (p instanceof RegionEntry) {
+                synchronized (p) {
+                  GatewaySenderEventImpl.release(((RegionEntry) p).getValue()); // OFFHEAP
                 }
+                OffHeapRegionEntryHelper.releaseKeyOfRemovedEntry(p);
               }
             }
-          };
-        } else {
-          runnable = new Runnable() {
-            @Override
-            public void run() {
-              for (HashEntry<?, ?> he : clearedEntries) {
-                for (HashEntry<?, ?> p = he; p != null; p = p.getNextEntry()) {
-                  synchronized (p) {
-                    ((OffHeapRegionEntry) p).release();
-                  }
-                }
+          }
+        }
+      };
+    } else {
+      runnable = new Runnable() {
+        @Override
+        public void run() {
+          for (HashEntry<?, ?> he : clearedEntries) {
+            for (HashEntry<?, ?> p = he; p != null; p = p.getNextEntry()) {
+              synchronized (p) {
+                ((OffHeapRegionEntry) p).release();
               }
             }
-          };
-        }
-        boolean submitted = false;
-        if (executor != null) {
-          try {
-            executor.execute(runnable);
-            submitted = true;
-          } catch (RejectedExecutionException e) {
-            // fall through with submitted false
-          } catch (CancelException e) {
-            // fall through with submitted false
-          } catch (NullPointerException e) {
-            // fall through with submitted false
           }
         }
-        if (!submitted) {
-          String name = this.getClass().getSimpleName() + "@" + this.hashCode() + " Clear Thread";
-          Thread thread = new LoggingThread(name, runnable);
-          thread.start();
-        }
+      };
+    }
+    boolean submitted = false;
+    if (executor != null) {
+      try {
+        executor.execute(runnable);
+        submitted = true;
+      } catch (RejectedExecutionException e) {
+        // fall through with submitted false
+      } catch (CancelException e) {
+        // fall through with submitted false
+      } catch (NullPointerException e) {
+        // fall through with submitted false
       }
     }
+    if (!submitted) {
+      String name = map.getClass().getSimpleName() + "@" + map.hashCode() + " Clear Thread";
+      Thread thread = new LoggingThread(name, runnable);
+      thread.start();
+    }
   }
 
   /**
@@ -0,0 +1,126 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.management;
+
+import java.beans.ConstructorProperties;
+import java.io.Serializable;
+
+/**
+ * Composite data type used to distribute one of the most frequently accessed keys of a Region on a
+ * member. The operation counts are estimates from a sample of the reads and writes of the Region,
+ * so they may overestimate the true counts by up to {@link #getError()} operations.
+ *
+ * @since Geode 1.13
+ */
+public class HotKeyData implements Serializable {
+
+  /**
+   * String representation of the key
+   */
+  private String key;
+
+  /**
+   * Estimated number of operations on the key
+   */
+  private long operations;
+
+  /**
+   * Maximum number of operations by which operations overestimates the true count
+   */
+  private long error;
+
+  /**
+   * Estimated number of reads of the key
+   */
+  private long reads;
+
+  /**
+   * Estimated number of writes of the key
+   */
+  private long writes;
+
+  /**
+   * Estimated rate of operations on the key per second
+   */
+  private double operationsPerSecond;
+
+  /**
+   * This constructor is to be used by internal JMX framework only. User should not try to create an
+   * instance of this class.
+   */
+  @ConstructorProperties({"key", "operations", "error", "reads", "writes", "operationsPerSecond"})
+  public HotKeyData(String key, long operations, long error, long reads, long writes,
+      double operationsPerSecond) {
+    this.key = key;
+    this.operations = operations;
+    this.error = error;
+    this.reads = reads;
+    this.writes = writes;
+    this.operationsPerSecond = operationsPerSecond;
+  }
+
+  /**
+   * Returns the string representation of the key.
+   */
+  public String getKey() {
+    return key;
+  }
+
+  /**
+   * Returns the estimated number of reads and writes of the key.
+   */
+  public long getOperations() {
+    return operations;
+  }
+
+  /**
+   * Returns the maximum number of operations by which {@link #getOperations()} may overestimate the
+   * true number of operations on the key.
+   */
+  public long getError() {
+    return error;
+  }
+
+  /**
+   * Returns the estimated number of reads of the key.
+   */
+  public long getReads() {
+    return reads;
+  }
+
+  /**
+   * Returns the estimated number of writes of the key.
+   */
+  public long getWrites() {
+    return writes;
+  }
+
+  /**
+   * Returns the estimated number of operations on the key per second.
+   */
+  public double getOperationsPerSecond() {
+    return operationsPerSecond;
+  }
+
+  /**
+   * String representation of HotKeyData
+   */
+  @Override
+  public String toString() {
+    return "HotKeyData [key=" + key + ", operations=" + operations + ", error=" + error
+        + ", reads=" + reads + ", writes=" + writes + ", operationsPerSecond="
+        + operationsPerSecond + "]";
+  }
+}
@@ -92,6 +92,14 @@ public interface RegionMXBean {
    */
   MembershipAttributesData listMembershipAttributes();
 
+  /**
+   * Returns the most frequently read and written keys of the Region on this member, most frequently
+   * accessed first. Returns an empty array if hot key tracking is not enabled.
+   *
+   * @since Geode 1.13
+   */
+  HotKeyData[] listHotKeys();
+
   /**
    * Returns the time of the most recent modification. For partitioned region it will be -1 . This
    * feature is not supported for partitioned regions.
@@ -18,6 +18,7 @@ import javax.management.NotificationBroadcasterSupport;
 
 import org.apache.geode.management.EvictionAttributesData;
 import org.apache.geode.management.FixedPartitionAttributesData;
+import org.apache.geode.management.HotKeyData;
 import org.apache.geode.management.MembershipAttributesData;
 import org.apache.geode.management.PartitionAttributesData;
 import org.apache.geode.management.RegionAttributesData;
@@ -147,6 +148,11 @@ public class RegionMBean<K, V> extends NotificationBroadcasterSupport implements
     return bridge.listMembershipAttributes();
   }
 
+  @Override
+  public HotKeyData[] listHotKeys() {
+    return bridge.listHotKeys();
+  }
+
   @Override
   public long getMissCount() {
     return bridge.getMissCount();
@@ -27,11 +27,13 @@ import org.apache.geode.internal.cache.DirectoryHolder;
 import org.apache.geode.internal.cache.DiskRegionStats;
 import org.apache.geode.internal.cache.DiskStoreImpl;
 import org.apache.geode.internal.cache.GemFireCacheImpl;
+import org.apache.geode.internal.cache.HotKeySketch;
 import org.apache.geode.internal.cache.InternalRegion;
 import org.apache.geode.internal.cache.LocalRegion;
 import org.apache.geode.internal.cache.PartitionedRegion;
 import org.apache.geode.management.EvictionAttributesData;
 import org.apache.geode.management.FixedPartitionAttributesData;
+import org.apache.geode.management.HotKeyData;
 import org.apache.geode.management.MembershipAttributesData;
 import org.apache.geode.management.PartitionAttributesData;
 import org.apache.geode.management.RegionAttributesData;
@@ -215,6 +217,14 @@ public class RegionMBeanBridge<K, V> {
     return membershipAttributesData;
   }
 
+  public HotKeyData[] listHotKeys() {
+    HotKeySketch hotKeySketch = HotKeySketch.of(region);
+    if (hotKeySketch == null) {
+      return new HotKeyData[0];
+    }
+    return hotKeySketch.getHotKeys().toArray(new HotKeyData[0]);
+  }
+
   public RegionAttributesData listRegionAttributes() {
     return regionAttributesData;
   }
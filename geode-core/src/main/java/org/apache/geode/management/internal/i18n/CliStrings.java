@@ -2007,6 +2007,23 @@ public class CliStrings {
       "Please view the dependencies between the members in file : {0}";
   public static final String SHOW_DEADLOCK__ERROR = "Error";
 
+  /* 'show hot-keys' command */
+  public static final String SHOW_HOT_KEYS = "show hot-keys";
+  public static final String SHOW_HOT_KEYS__HELP =
+      "Display the most frequently read and written keys of a region on each member.";
+  public static final String SHOW_HOT_KEYS__REGION = "region";
+  public static final String SHOW_HOT_KEYS__REGION__HELP =
+      "Name/Path of the region whose hot keys will be displayed.";
+  public static final String SHOW_HOT_KEYS__MEMBER__HELP =
+      "Name/Id of the member(s) whose hot keys will be displayed.";
+  public static final String SHOW_HOT_KEYS__GROUP__HELP =
+      "Group(s) of members whose hot keys will be displayed.";
+  public static final String SHOW_HOT_KEYS__LIMIT = "limit";
+  public static final String SHOW_HOT_KEYS__LIMIT__HELP =
+      "Maximum number of keys to display per member.";
+  public static final String SHOW_HOT_KEYS__NOT_TRACKED =
+      "Hot keys of region {0} are not tracked on any of the members. Set the gemfire.HOT_KEY_CAPACITY system property to track them.";
+
   /* Show Log command */
   public static final String SHOW_LOG = "show log";
   public static final String SHOW_LOG_HELP = "Display the log for a member.";
@@ -2061,6 +2078,20 @@ public class CliStrings {
   public static final String SHOW_MISSING_DISK_STORE__ERROR_MESSAGE =
       "An error occurred while showing missing disk stores and missing colocated regions: %1$s";
 
+  /* 'show region-entry-shape' command */
+  public static final String SHOW_REGION_ENTRY_SHAPE = "show region-entry-shape";
+  public static final String SHOW_REGION_ENTRY_SHAPE__HELP =
+      "Display the per member statistics about the shape of the entries created for a region.";
+  public static final String SHOW_REGION_ENTRY_SHAPE__REGION = "region";
+  public static final String SHOW_REGION_ENTRY_SHAPE__REGION__HELP =
+      "Name/Path of the region whose entry shape statistics will be displayed.";
+  public static final String SHOW_REGION_ENTRY_SHAPE__MEMBER__HELP =
+      "Name/Id of the member(s) whose entry shape statistics will be displayed.";
+  public static final String SHOW_REGION_ENTRY_SHAPE__GROUP__HELP =
+      "Group(s) of members whose entry shape statistics will be displayed.";
+  public static final String SHOW_REGION_ENTRY_SHAPE__STATISTIC__HEADER = "Statistic";
+  public static final String SHOW_REGION_ENTRY_SHAPE__VALUE__HEADER = "Value";
+
   /* 'shutdown' command */
   public static final String SHUTDOWN = "shutdown";
   public static final String SHUTDOWN__HELP = "Stop all members.";
@@ -27,6 +27,7 @@ import static org.mockito.ArgumentMatchers.anyLong;
 import static org.mockito.ArgumentMatchers.eq;
 import static org.mockito.Mockito.RETURNS_DEEP_STUBS;
 import static org.mockito.Mockito.doThrow;
+import static org.mockito.Mockito.inOrder;
 import static org.mockito.Mockito.mock;
 import static org.mockito.Mockito.never;
 import static org.mockito.Mockito.times;
@@ -38,9 +39,14 @@ import java.io.DataOutput;
 import java.io.IOException;
 import java.util.ArrayList;
 import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 
 import org.junit.After;
 import org.junit.Test;
+import org.mockito.InOrder;
 import org.mockito.invocation.InvocationOnMock;
 import org.mockito.stubbing.Answer;
 
@@ -53,7 +59,10 @@ import org.apache.geode.cache.TransactionId;
 import org.apache.geode.cache.client.internal.ServerRegionProxy;
 import org.apache.geode.distributed.internal.InternalDistributedSystem;
 import org.apache.geode.distributed.internal.membership.InternalDistributedMember;
+import org.apache.geode.internal.cache.entries.AbstractRegionEntry;
 import org.apache.geode.internal.cache.entries.DiskEntry.RecoveredEntry;
+import org.apache.geode.internal.cache.entries.SerializedKeyRegionEntry;
+import org.apache.geode.internal.cache.entries.VMThinRegionEntryOffHeapSerializedKey;
 import org.apache.geode.internal.cache.eviction.EvictableEntry;
 import org.apache.geode.internal.cache.eviction.EvictionController;
 import org.apache.geode.internal.cache.eviction.EvictionCounters;
@@ -64,8 +73,14 @@ import org.apache.geode.internal.cache.versions.VersionHolder;
 import org.apache.geode.internal.cache.versions.VersionSource;
 import org.apache.geode.internal.cache.versions.VersionStamp;
 import org.apache.geode.internal.cache.versions.VersionTag;
+import org.apache.geode.internal.offheap.MemoryAllocator;
+import org.apache.geode.internal.offheap.MemoryAllocatorImpl;
+import org.apache.geode.internal.offheap.OffHeapMemoryStats;
+import org.apache.geode.internal.offheap.OffHeapRegionEntryHelper;
+import org.apache.geode.internal.offheap.OutOfOffHeapMemoryListener;
 import org.apache.geode.internal.serialization.Version;
 import org.apache.geode.internal.util.concurrent.ConcurrentMapWithReusableEntries;
+import org.apache.geode.internal.util.concurrent.CustomEntryBinnedConcurrentHashMap;
 import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap;
 
 public class AbstractRegionMapTest {
@@ -1022,6 +1037,111 @@ public class AbstractRegionMapTest {
     verify(arm._getOwner(), times(1)).updateSizeOnCreate(any(), anyInt());
   }
 
+  @Test
+  public void initialImagePut_duringBulkLoad_incrementsEntryCountWhenBulkLoadEnds()
+      throws RegionClearedException {
+    ConcurrentMapWithReusableEntries map = mock(ConcurrentMapWithReusableEntries.class);
+    when(map.putIfAbsent(any(), any())).thenReturn(null);
+    RegionEntryFactory factory = mock(RegionEntryFactory.class);
+    RegionEntry createdEntry = mock(RegionEntry.class);
+    when(createdEntry.getVersionStamp()).thenReturn(mock(VersionStamp.class));
+    when(createdEntry.initialImageInit(any(), anyLong(), any(), anyBoolean(), anyBoolean(),
+        anyBoolean())).thenReturn(true);
+    when(factory.createEntry(any(), any(), any())).thenReturn(createdEntry);
+    final TestableAbstractRegionMap arm = new TestableAbstractRegionMap(false, map, factory);
+    CachePerfStats cachePerfStats = arm._getOwner().getCachePerfStats();
+
+    arm.beginBulkLoad();
+    arm.beginBulkLoad();
+    arm.initialImagePut(KEY, 0, "", false, false, null, null, false);
+    arm.initialImagePut("key2", 0, "", false, false, null, null, false);
+    arm.endBulkLoad();
+
+    verify(cachePerfStats, never()).incEntryCount(anyInt());
+    verify(arm._getOwner(), never()).updateSizeOnBulkCreate(anyInt(), anyLong());
+
+    arm.endBulkLoad();
+
+    verify(cachePerfStats, times(1)).incEntryCount(2);
+    verify(arm._getOwner(), times(1)).updateSizeOnBulkCreate(eq(2), anyLong());
+    verify(arm._getOwner(), never()).updateSizeOnCreate(any(), anyInt());
+  }
+
+  @Test
+  public void removeEntry_duringBulkLoad_countsPendingEntryBeforeUncountingIt()
+      throws RegionClearedException {
+    ConcurrentMapWithReusableEntries map = mock(ConcurrentMapWithReusableEntries.class);
+    when(map.putIfAbsent(any(), any())).thenReturn(null);
+    RegionEntryFactory factory = mock(RegionEntryFactory.class);
+    RegionEntry createdEntry = mock(RegionEntry.class);
+    when(createdEntry.getVersionStamp()).thenReturn(mock(VersionStamp.class));
+    when(createdEntry.initialImageInit(any(), anyLong(), any(), anyBoolean(), anyBoolean(),
+        anyBoolean())).thenReturn(true);
+    when(factory.createEntry(any(), any(), any())).thenReturn(createdEntry);
+    when(map.remove(KEY, createdEntry)).thenReturn(true);
+    final TestableAbstractRegionMap arm = new TestableAbstractRegionMap(false, map, factory);
+    LocalRegion owner = arm._getOwner();
+    when(owner.calculateRegionEntryValueSize(createdEntry)).thenReturn(100);
+    CachePerfStats cachePerfStats = owner.getCachePerfStats();
+
+    arm.beginBulkLoad();
+    arm.initialImagePut(KEY, 0, "", false, false, null, null, false);
+    arm.removeEntry(KEY, createdEntry, true);
+    arm.endBulkLoad();
+
+    InOrder inOrder = inOrder(owner, cachePerfStats);
+    inOrder.verify(owner, times(1)).updateSizeOnBulkCreate(1, 100);
+    inOrder.verify(cachePerfStats, times(1)).incEntryCount(1);
+    inOrder.verify(cachePerfStats, times(1)).incEntryCount(-1);
+    verify(owner, times(1)).updateSizeOnBulkCreate(anyInt(), anyLong());
+    verify(cachePerfStats, times(2)).incEntryCount(anyInt());
+  }
+
+  @Test
+  public void initialImagePut_duringBulkLoad_shrinkingPendingEntryCountsItBeforeUpdatingSize()
+      throws RegionClearedException {
+    ConcurrentMapWithReusableEntries map = mock(ConcurrentMapWithReusableEntries.class);
+    RegionEntryFactory factory = mock(RegionEntryFactory.class);
+    RegionEntry createdEntry = mock(RegionEntry.class);
+    when(createdEntry.getVersionStamp()).thenReturn(mock(VersionStamp.class));
+    when(createdEntry.initialImageInit(any(), anyLong(), any(), anyBoolean(), anyBoolean(),
+        anyBoolean())).thenReturn(true);
+    when(createdEntry.initialImagePut(any(), anyLong(), any(), anyBoolean(), anyBoolean()))
+        .thenReturn(true);
+    when(factory.createEntry(any(), any(), any())).thenReturn(createdEntry,
+        mock(RegionEntry.class));
+    when(map.putIfAbsent(eq(KEY), any())).thenReturn(null, createdEntry);
+    final TestableAbstractRegionMap arm = new TestableAbstractRegionMap(false, map, factory);
+    LocalRegion owner = arm._getOwner();
+    when(owner.calculateRegionEntryValueSize(createdEntry)).thenReturn(100, 100, 10);
+    CachePerfStats cachePerfStats = owner.getCachePerfStats();
+
+    arm.beginBulkLoad();
+    arm.initialImagePut(KEY, 0, "", false, false, null, null, false);
+    arm.initialImagePut(KEY, 0, "", false, false, null, null, false);
+    arm.endBulkLoad();
+
+    InOrder inOrder = inOrder(owner);
+    inOrder.verify(owner, times(1)).updateSizeOnBulkCreate(1, 100);
+    inOrder.verify(owner, times(1)).updateSizeOnPut(KEY, 100, 10);
+    verify(owner, times(1)).updateSizeOnBulkCreate(anyInt(), anyLong());
+    verify(cachePerfStats, times(1)).incEntryCount(1);
+  }
+
+  @Test
+  public void getBulkLoad_returnsNullOnThreadsThatDidNotBeginIt() throws Exception {
+    final TestableAbstractRegionMap arm = new TestableAbstractRegionMap();
+
+    arm.beginBulkLoad();
+
+    assertThat(arm.getBulkLoad()).isNotNull();
+    assertThat(CompletableFuture.supplyAsync(arm::getBulkLoad).get()).isNull();
+
+    arm.endBulkLoad();
+
+    assertThat(arm.getBulkLoad()).isNull();
+  }
+
 
   @Test
   public void initialImagePut_ExceptionThrownWhenCreatingNewRegionEntry_removeDoesNotGetCalled()
@@ -1144,6 +1264,56 @@ public class AbstractRegionMapTest {
     verify(arm._getOwner(), never()).updateSizeOnCreate(any(), anyInt());
   }
 
+  @Test
+  public void putEntryIfAbsentReleasesOffHeapKeysOfEntriesThatLoseTheRaceInBinnedMap()
+      throws Exception {
+    MemoryAllocator allocator = MemoryAllocatorImpl.create(mock(OutOfOffHeapMemoryListener.class),
+        mock(OffHeapMemoryStats.class), 1, 1024 * 1024, 1024 * 1024);
+    ExecutorService executor = Executors.newFixedThreadPool(4);
+    try {
+      TestableAbstractRegionMap arm = new TestableAbstractRegionMap(false,
+          new CustomEntryBinnedConcurrentHashMap<>(16, 0.75f, 16, false,
+              new AbstractRegionEntry.HashRegionEntryCreator()),
+          null);
+      long usedMemory = allocator.getUsedMemory();
+      int keys = 1000;
+      List<Future<List<SerializedKeyRegionEntry>>> futures = new ArrayList<>();
+      for (int t = 0; t < 4; t++) {
+        futures.add(executor.submit(() -> {
+          List<SerializedKeyRegionEntry> losers = new ArrayList<>();
+          for (int i = 0; i < keys; i++) {
+            String key = "a key that is too long to be encoded in an address " + i;
+            SerializedKeyRegionEntry entry =
+                new VMThinRegionEntryOffHeapSerializedKey(null, key, null);
+            if (arm.putEntryIfAbsent(key, entry) != null) {
+              losers.add(entry);
+            }
+          }
+          return losers;
+        }));
+      }
+      int lost = 0;
+      for (Future<List<SerializedKeyRegionEntry>> future : futures) {
+        for (SerializedKeyRegionEntry loser : future.get()) {
+          assertThat(loser.getKeyAddress()).isZero();
+          assertThat(loser.getHeapKey()).isNotNull();
+          lost++;
+        }
+      }
+      assertThat(lost).isEqualTo(3 * keys);
+      assertThat(arm.getEntryMap().size()).isEqualTo(keys);
+
+      for (Object entry : arm.getEntryMap().values()) {
+        assertThat(((SerializedKeyRegionEntry) entry).getHeapKey()).isNull();
+        OffHeapRegionEntryHelper.releaseKey((SerializedKeyRegionEntry) entry);
+      }
+      assertThat(allocator.getUsedMemory()).isEqualTo(usedMemory);
+    } finally {
+      executor.shutdownNow();
+      MemoryAllocatorImpl.freeOffHeapMemory();
+    }
+  }
+
   private EntryEventImpl createEventForInvalidate(LocalRegion lr) {
     when(lr.getKeyInfo(KEY)).thenReturn(new KeyInfo(KEY, null, null));
     return EntryEventImpl.create(lr, Operation.INVALIDATE, KEY, false, null, true, false);
@@ -0,0 +1,261 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache;
+
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.when;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import org.junit.Before;
+import org.junit.Test;
+
+import org.apache.geode.internal.InternalStatisticsDisabledException;
+import org.apache.geode.internal.cache.entries.AbstractRegionEntry;
+import org.apache.geode.internal.cache.entries.VMStatsRegionEntryHeapObjectKey;
+
+public class EntryExpiryWheelTest {
+
+  private static final long TICK = 100;
+  private static final long START = 1_000_000;
+
+  private final Map<RegionEntry, Long> expirationTimes = new HashMap<>();
+  private final List<RegionEntry> expired = new ArrayList<>();
+  private Runnable afterGetExpirationTime = () -> {
+  };
+  private RegionEntryContext context;
+  private EntryExpiryWheel wheel;
+
+  @Before
+  public void setUp() {
+    LocalRegion region = mock(LocalRegion.class);
+    when(region.usesEntryExpiryWheel()).thenReturn(true);
+    context = mock(RegionEntryContext.class);
+    wheel = new EntryExpiryWheel(region, TICK, START) {
+      @Override
+      long getExpirationTime(RegionEntry re) {
+        long expirationTime = expirationTimes.getOrDefault(re, 0L);
+        afterGetExpirationTime.run();
+        return expirationTime;
+      }
+
+      @Override
+      void expire(RegionEntry re) {
+        expired.add(re);
+      }
+    };
+  }
+
+  private AbstractRegionEntry createEntry(long expirationTime) {
+    AbstractRegionEntry re = new VMStatsRegionEntryHeapObjectKey(context, "key", "value");
+    expirationTimes.put(re, expirationTime);
+    return re;
+  }
+
+  @Test
+  public void entryExpiresOnTheTickOfItsExpirationTime() {
+    AbstractRegionEntry re = createEntry(START + 1050);
+    assertThat(wheel.add(re)).isTrue();
+    assertThat(re.isExpiryScheduled()).isTrue();
+
+    wheel.advanceTo(START + 1099);
+    assertThat(expired).isEmpty();
+
+    wheel.advanceTo(START + 1100);
+    assertThat(expired).containsExactly(re);
+    assertThat(re.isExpiryScheduled()).isFalse();
+    assertThat(wheel.size()).isZero();
+  }
+
+  @Test
+  public void entryThatIsDueIsExpiredOnTheNextTick() {
+    AbstractRegionEntry re = createEntry(START - 5000);
+    wheel.add(re);
+
+    wheel.advanceTo(START + TICK);
+
+    assertThat(expired).containsExactly(re);
+  }
+
+  @Test
+  public void touchedEntryIsPlacedAgainInsteadOfExpired() {
+    AbstractRegionEntry re = createEntry(START + 500);
+    wheel.add(re);
+    expirationTimes.put(re, START + 2000L);
+
+    wheel.advanceTo(START + 500);
+    assertThat(expired).isEmpty();
+    assertThat(re.isExpiryScheduled()).isTrue();
+    assertThat(wheel.size()).isEqualTo(1);
+
+    wheel.advanceTo(START + 2000);
+    assertThat(expired).containsExactly(re);
+  }
+
+  @Test
+  public void entriesOnHigherLevelsExpireOnTime() {
+    long level1 = START + 3 * 64 * TICK + 7;
+    long level2 = START + 5 * 64 * 64 * TICK + 3;
+    long overflow = START + 64L * 64 * 64 * 64 * TICK + 11;
+    AbstractRegionEntry re1 = createEntry(level1);
+    AbstractRegionEntry re2 = createEntry(level2);
+    AbstractRegionEntry re3 = createEntry(overflow);
+    wheel.add(re1);
+    wheel.add(re2);
+    wheel.add(re3);
+
+    wheel.advanceTo(level1 - 8);
+    assertThat(expired).isEmpty();
+    wheel.advanceTo(level1 + TICK);
+    assertThat(expired).containsExactly(re1);
+
+    wheel.advanceTo(level2 - 4);
+    assertThat(expired).containsExactly(re1);
+    wheel.advanceTo(level2 + TICK);
+    assertThat(expired).containsExactly(re1, re2);
+
+    wheel.advanceTo(overflow - 12);
+    assertThat(expired).containsExactly(re1, re2);
+    wheel.advanceTo(overflow + TICK);
+    assertThat(expired).containsExactly(re1, re2, re3);
+    assertThat(wheel.size()).isZero();
+  }
+
+  @Test
+  public void entryAddedWhileCascadeDropsItStaysInTheWheel() {
+    long expirationTime = START + 3 * 64 * TICK + 7;
+    AbstractRegionEntry re = createEntry(expirationTime);
+    wheel.add(re);
+    // expiration is turned off and on again while the entry's level 1 bucket is cascaded
+    expirationTimes.put(re, 0L);
+    afterGetExpirationTime = () -> {
+      afterGetExpirationTime = () -> {
+      };
+      expirationTimes.put(re, expirationTime);
+      // the cascade has cleared the mark, so the add places the entry again itself
+      assertThat(wheel.add(re)).isTrue();
+    };
+
+    wheel.advanceTo(START + 3 * 64 * TICK);
+    assertThat(re.isExpiryScheduled()).isTrue();
+    assertThat(wheel.size()).isEqualTo(1);
+
+    wheel.advanceTo(expirationTime + TICK);
+    assertThat(expired).containsExactly(re);
+  }
+
+  @Test
+  public void addIgnoresEntryThatIsAlreadyInTheWheel() {
+    AbstractRegionEntry re = createEntry(START + 1000);
+
+    assertThat(wheel.add(re)).isTrue();
+    assertThat(wheel.add(re)).isFalse();
+
+    assertThat(wheel.size()).isEqualTo(1);
+  }
+
+  @Test
+  public void addIgnoresEntryThatDoesNotExpire() {
+    AbstractRegionEntry re = createEntry(0);
+
+    assertThat(wheel.add(re)).isFalse();
+
+    assertThat(re.isExpiryScheduled()).isFalse();
+    assertThat(wheel.size()).isZero();
+  }
+
+  @Test
+  public void removedEntryIsDropped() throws Exception {
+    AbstractRegionEntry re = createEntry(START + 1000);
+    wheel.add(re);
+    re.setValue(context, Token.REMOVED_PHASE2);
+
+    wheel.advanceTo(START + 1000);
+
+    assertThat(expired).isEmpty();
+    assertThat(re.isExpiryScheduled()).isFalse();
+    assertThat(wheel.size()).isZero();
+  }
+
+  @Test
+  public void destroyedEntriesArePurgedOnceTheyMakeUpHalfOfTheWheel() throws Exception {
+    List<AbstractRegionEntry> live = new ArrayList<>();
+    List<AbstractRegionEntry> destroyed = new ArrayList<>();
+    for (int i = 0; i < EntryExpiryWheel.MIN_PURGE_COUNT; i++) {
+      live.add(createEntry(START + 1000000));
+      destroyed.add(createEntry(START + 1000000));
+    }
+    live.forEach(wheel::add);
+    destroyed.forEach(wheel::add);
+
+    for (AbstractRegionEntry re : destroyed) {
+      assertThat(wheel.size()).isEqualTo(2 * EntryExpiryWheel.MIN_PURGE_COUNT);
+      re.setValue(context, Token.REMOVED_PHASE2);
+      wheel.entryDestroyed(re);
+    }
+
+    assertThat(wheel.size()).isEqualTo(EntryExpiryWheel.MIN_PURGE_COUNT);
+    assertThat(destroyed).noneMatch(AbstractRegionEntry::isExpiryScheduled);
+    assertThat(live).allMatch(AbstractRegionEntry::isExpiryScheduled);
+    wheel.advanceTo(START + 1000000);
+    assertThat(expired).containsExactlyInAnyOrderElementsOf(live);
+  }
+
+  @Test
+  public void entryDestroyedIgnoresEntryThatIsNotInTheWheel() throws Exception {
+    AbstractRegionEntry re = createEntry(START + 1000);
+    re.setValue(context, Token.REMOVED_PHASE2);
+
+    wheel.entryDestroyed(re);
+
+    assertThat(re.isExpiryScheduled()).isFalse();
+    assertThat(wheel.size()).isZero();
+  }
+
+  @Test
+  public void entryWithoutStatisticsDoesNotExpireByIdleTime() throws Exception {
+    LocalRegion region = mock(LocalRegion.class);
+    region.entryIdleTimeout = 10;
+    RegionEntry re = mock(RegionEntry.class);
+    when(re.getLastAccessed()).thenThrow(new InternalStatisticsDisabledException());
+    when(re.getLastModified()).thenReturn(START);
+    EntryExpiryWheel wheel = new EntryExpiryWheel(region, TICK, START);
+
+    assertThat(wheel.getExpirationTime(re)).isZero();
+
+    region.entryTimeToLive = 20;
+    assertThat(wheel.getExpirationTime(re)).isEqualTo(START + 20000);
+  }
+
+  @Test
+  public void clearRemovesAllEntries() {
+    AbstractRegionEntry re1 = createEntry(START + 1000);
+    AbstractRegionEntry re2 = createEntry(START + 1000000);
+    wheel.add(re1);
+    wheel.add(re2);
+
+    wheel.clear();
+
+    assertThat(wheel.size()).isZero();
+    assertThat(re1.isExpiryScheduled()).isFalse();
+    assertThat(re2.isExpiryScheduled()).isFalse();
+    wheel.advanceTo(START + 1000000);
+    assertThat(expired).isEmpty();
+  }
+}
@@ -0,0 +1,224 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache;
+
+import static org.apache.geode.internal.cache.HotKeySketch.hottestKeyOperationsPerSecondId;
+import static org.apache.geode.internal.cache.HotKeySketch.monitoredKeysId;
+import static org.apache.geode.internal.cache.HotKeySketch.replacedKeysId;
+import static org.apache.geode.internal.cache.HotKeySketch.sampledOperationsId;
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.mockito.ArgumentMatchers.eq;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.when;
+
+import java.util.List;
+
+import org.junit.Before;
+import org.junit.Test;
+
+import org.apache.geode.Statistics;
+import org.apache.geode.StatisticsFactory;
+import org.apache.geode.StatisticsType;
+import org.apache.geode.internal.statistics.StatisticsManager;
+import org.apache.geode.internal.statistics.StripedStatisticsImpl;
+import org.apache.geode.management.HotKeyData;
+
+public class HotKeySketchTest {
+
+  private static final String TEXT_ID = "HotKeyStats-/region";
+  private static final long WINDOW = 10000;
+
+  private StatisticsFactory statisticsFactory;
+  private Statistics statistics;
+  private long now;
+
+  @Before
+  public void setUp() {
+    StatisticsType statisticsType = HotKeySketch.getStatisticsType();
+    statisticsFactory = mock(StatisticsFactory.class);
+    statistics = new StripedStatisticsImpl(statisticsType, TEXT_ID, 1, 1,
+        mock(StatisticsManager.class));
+    when(statisticsFactory.createAtomicStatistics(eq(statisticsType), eq(TEXT_ID)))
+        .thenReturn(statistics);
+  }
+
+  private HotKeySketch createSketch(int capacity, int sampleInterval) {
+    return new HotKeySketch(statisticsFactory, TEXT_ID, capacity, sampleInterval, WINDOW,
+        () -> now);
+  }
+
+  private static void record(HotKeySketch sketch, Object key, int times, long now) {
+    for (int i = 0; i < times; i++) {
+      sketch.record(key, false, now);
+    }
+  }
+
+  @Test
+  public void reportsKeysMostFrequentlyAccessedFirst() {
+    HotKeySketch sketch = createSketch(10, 1);
+    record(sketch, "warm", 5, 0);
+    record(sketch, "hot", 9, 0);
+    record(sketch, "cold", 1, 0);
+
+    List<HotKeyData> hotKeys = sketch.getHotKeys(1000);
+
+    assertThat(hotKeys).extracting(HotKeyData::getKey).containsExactly("hot", "warm", "cold");
+    assertThat(hotKeys).extracting(HotKeyData::getOperations).containsExactly(9L, 5L, 1L);
+    assertThat(hotKeys).extracting(HotKeyData::getError).containsOnly(0L);
+    assertThat(hotKeys.get(0).getOperationsPerSecond()).isEqualTo(9.0);
+  }
+
+  @Test
+  public void countsReadsAndWritesSeparately() {
+    HotKeySketch sketch = createSketch(10, 1);
+    sketch.record("key", false, 0);
+    sketch.record("key", true, 0);
+    sketch.record("key", true, 0);
+
+    HotKeyData hotKey = sketch.getHotKeys(0).get(0);
+
+    assertThat(hotKey.getOperations()).isEqualTo(3);
+    assertThat(hotKey.getReads()).isEqualTo(1);
+    assertThat(hotKey.getWrites()).isEqualTo(2);
+  }
+
+  @Test
+  public void keyThatIsNotMonitoredReplacesKeyWithLowestCount() {
+    HotKeySketch sketch = createSketch(2, 1);
+    record(sketch, "a", 3, 0);
+    record(sketch, "b", 1, 0);
+
+    sketch.record("c", true, 0);
+
+    List<HotKeyData> hotKeys = sketch.getHotKeys(0);
+    assertThat(hotKeys).extracting(HotKeyData::getKey).containsExactly("a", "c");
+    HotKeyData replacement = hotKeys.get(1);
+    assertThat(replacement.getOperations()).isEqualTo(2);
+    assertThat(replacement.getError()).isEqualTo(1);
+    assertThat(replacement.getWrites()).isEqualTo(1);
+    assertThat(statistics.getLong(replacedKeysId)).isEqualTo(1);
+    assertThat(statistics.getLong(monitoredKeysId)).isEqualTo(2);
+  }
+
+  @Test
+  public void frequentKeyIsMonitoredAmongManyInfrequentKeys() {
+    HotKeySketch sketch = createSketch(8, 1);
+    for (int i = 0; i < 10000; i++) {
+      sketch.record(i, false, 0);
+      if (i % 4 == 0) {
+        sketch.record("hot", false, 0);
+      }
+    }
+
+    HotKeyData hottest = sketch.getHotKeys(0).get(0);
+
+    assertThat(hottest.getKey()).isEqualTo("hot");
+    assertThat(hottest.getOperations() - hottest.getError()).isLessThanOrEqualTo(2500);
+    assertThat(hottest.getOperations()).isGreaterThanOrEqualTo(2500);
+  }
+
+  @Test
+  public void countsAreScaledBySampleInterval() {
+    HotKeySketch sketch = createSketch(10, 4);
+    record(sketch, "key", 3, 0);
+
+    HotKeyData hotKey = sketch.getHotKeys(0).get(0);
+
+    assertThat(hotKey.getOperations()).isEqualTo(12);
+    assertThat(hotKey.getReads()).isEqualTo(12);
+    assertThat(statistics.getLong(sampledOperationsId)).isEqualTo(3);
+  }
+
+  @Test
+  public void reportsLastCompleteWindowOnceAWindowHasEnded() {
+    HotKeySketch sketch = createSketch(10, 1);
+    record(sketch, "old", 20, 0);
+
+    record(sketch, "new", 5, WINDOW);
+
+    List<HotKeyData> hotKeys = sketch.getHotKeys(WINDOW + 1000);
+    assertThat(hotKeys).extracting(HotKeyData::getKey).containsExactly("old");
+    assertThat(hotKeys.get(0).getOperationsPerSecond()).isEqualTo(2.0);
+    assertThat(statistics.getLong(hottestKeyOperationsPerSecondId)).isEqualTo(2);
+
+    hotKeys = sketch.getHotKeys(2 * WINDOW);
+    assertThat(hotKeys).extracting(HotKeyData::getKey).containsExactly("new");
+  }
+
+  @Test
+  public void mergesCountsRecordedByConcurrentThreads() throws Exception {
+    HotKeySketch sketch = createSketch(10, 1);
+    Thread[] threads = new Thread[8];
+    for (int i = 0; i < threads.length; i++) {
+      threads[i] = new Thread(() -> {
+        record(sketch, "hot", 1000, 0);
+        record(sketch, "warm", 100, 0);
+      });
+      threads[i].start();
+    }
+    for (Thread thread : threads) {
+      thread.join();
+    }
+
+    List<HotKeyData> hotKeys = sketch.getHotKeys(0);
+
+    assertThat(hotKeys).extracting(HotKeyData::getKey).containsExactly("hot", "warm");
+    assertThat(hotKeys).extracting(HotKeyData::getOperations).containsExactly(8000L, 800L);
+    assertThat(hotKeys).extracting(HotKeyData::getError).containsOnly(0L);
+    assertThat(statistics.getLong(sampledOperationsId)).isEqualTo(8800);
+  }
+
+  @Test
+  public void monitorsAtMostCapacityKeysAcrossStripes() throws Exception {
+    int capacity = 4 * HotKeySketch.MIN_STRIPE_CAPACITY;
+    HotKeySketch sketch = createSketch(capacity, 1);
+    Thread[] threads = new Thread[16];
+    for (int i = 0; i < threads.length; i++) {
+      int thread = i;
+      threads[i] = new Thread(() -> {
+        for (int key = 0; key < 1000; key++) {
+          sketch.record(thread * 1000 + key, false, 0);
+        }
+      });
+      threads[i].start();
+    }
+    for (Thread thread : threads) {
+      thread.join();
+    }
+
+    assertThat(statistics.getLong(monitoredKeysId)).isLessThanOrEqualTo(capacity);
+    assertThat(sketch.getHotKeys(0)).hasSizeLessThanOrEqualTo(capacity);
+  }
+
+  @Test
+  public void recordReadUsesKeyOfEntry() {
+    HotKeySketch sketch = createSketch(10, 1);
+    RegionEntry re = mock(RegionEntry.class);
+    when(re.getKey()).thenReturn("key");
+
+    sketch.recordRead(re);
+    sketch.recordWrite(re);
+
+    HotKeyData hotKey = sketch.getHotKeys().get(0);
+    assertThat(hotKey.getKey()).isEqualTo("key");
+    assertThat(hotKey.getReads()).isEqualTo(1);
+    assertThat(hotKey.getWrites()).isEqualTo(1);
+  }
+
+  @Test
+  public void createIfEnabledReturnsNullByDefault() {
+    assertThat(HotKeySketch.createIfEnabled(statisticsFactory, TEXT_ID)).isNull();
+  }
+}
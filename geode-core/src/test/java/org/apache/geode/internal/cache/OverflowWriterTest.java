@@ -0,0 +1,115 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache;
+
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.verify;
+
+import java.util.List;
+import java.util.concurrent.CopyOnWriteArrayList;
+import java.util.function.Consumer;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import org.apache.geode.internal.cache.DiskStoreImpl.AsyncDiskEntry;
+import org.apache.geode.internal.cache.entries.DiskEntry;
+
+public class OverflowWriterTest {
+
+  private final List<AsyncDiskEntry> written = new CopyOnWriteArrayList<>();
+  private DiskStoreStats stats;
+  private InternalRegion region;
+  private OverflowWriter overflowWriter;
+
+  @Before
+  public void setUp() {
+    stats = mock(DiskStoreStats.class);
+    region = mock(InternalRegion.class);
+  }
+
+  @After
+  public void tearDown() {
+    if (overflowWriter != null) {
+      overflowWriter.close();
+    }
+  }
+
+  private OverflowWriter createOverflowWriter(int queueSize, Consumer<AsyncDiskEntry> writer) {
+    overflowWriter = new OverflowWriter("test overflow writer", stats, queueSize, 4, writer);
+    return overflowWriter;
+  }
+
+  private AsyncDiskEntry createEntry() {
+    return new AsyncDiskEntry(region, mock(DiskEntry.class), null);
+  }
+
+  @Test
+  public void flushWaitsUntilScheduledEntriesAreWritten() {
+    OverflowWriter overflowWriter = createOverflowWriter(100, written::add);
+    overflowWriter.start();
+    AsyncDiskEntry ade1 = createEntry();
+    AsyncDiskEntry ade2 = createEntry();
+
+    assertThat(overflowWriter.schedule(ade1)).isTrue();
+    assertThat(overflowWriter.schedule(ade2)).isTrue();
+    overflowWriter.flush();
+
+    assertThat(written).containsExactly(ade1, ade2);
+  }
+
+  @Test
+  public void scheduleReturnsFalseWhenQueueIsFull() {
+    OverflowWriter overflowWriter = createOverflowWriter(1, written::add);
+
+    assertThat(overflowWriter.schedule(createEntry())).isTrue();
+    assertThat(overflowWriter.schedule(createEntry())).isFalse();
+
+    verify(stats).incOverflowWriterCallerWrites();
+  }
+
+  @Test
+  public void closeWritesQueuedEntries() {
+    OverflowWriter overflowWriter = createOverflowWriter(10, written::add);
+    AsyncDiskEntry ade = createEntry();
+    overflowWriter.schedule(ade);
+
+    overflowWriter.close();
+
+    assertThat(written).containsExactly(ade);
+    assertThat(overflowWriter.schedule(createEntry())).isFalse();
+  }
+
+  @Test
+  public void failedWriteDoesNotStopWriter() {
+    AsyncDiskEntry failing = createEntry();
+    OverflowWriter overflowWriter = createOverflowWriter(10, ade -> {
+      if (ade == failing) {
+        throw new IllegalStateException("expected");
+      }
+      written.add(ade);
+    });
+    overflowWriter.start();
+    AsyncDiskEntry ade = createEntry();
+
+    overflowWriter.schedule(failing);
+    overflowWriter.schedule(ade);
+    overflowWriter.flush();
+
+    assertThat(written).containsExactly(ade);
+  }
+}
@@ -0,0 +1,130 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache;
+
+import static org.apache.geode.internal.cache.RegionEntryShapeStats.objectKeyEntriesId;
+import static org.apache.geode.internal.cache.RegionEntryShapeStats.stringKeyNotByteEncodableId;
+import static org.apache.geode.internal.cache.RegionEntryShapeStats.stringKeyTooLongId;
+import static org.apache.geode.internal.cache.RegionEntryShapeStats.stringKeysLength0To3Id;
+import static org.apache.geode.internal.cache.RegionEntryShapeStats.stringKeysLength16To31Id;
+import static org.apache.geode.internal.cache.RegionEntryShapeStats.stringKeysLength64AndOverId;
+import static org.apache.geode.internal.cache.RegionEntryShapeStats.stringKeysLength8To15Id;
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.mockito.ArgumentMatchers.eq;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.when;
+
+import org.junit.Before;
+import org.junit.Test;
+
+import org.apache.geode.Statistics;
+import org.apache.geode.StatisticsFactory;
+import org.apache.geode.StatisticsType;
+import org.apache.geode.internal.statistics.StatisticsManager;
+import org.apache.geode.internal.statistics.StripedStatisticsImpl;
+
+public class RegionEntryShapeStatsTest {
+
+  private static final String TEXT_ID = "RegionEntryShapeStats-/region";
+
+  private Statistics statistics;
+  private RegionEntryShapeStats shapeStats;
+
+  @Before
+  public void setUp() {
+    StatisticsType statisticsType = RegionEntryShapeStats.getStatisticsType();
+    StatisticsFactory statisticsFactory = mock(StatisticsFactory.class);
+    statistics = new StripedStatisticsImpl(statisticsType, TEXT_ID, 1, 1,
+        mock(StatisticsManager.class));
+    when(statisticsFactory.createAtomicStatistics(eq(statisticsType), eq(TEXT_ID)))
+        .thenReturn(statistics);
+
+    shapeStats = new RegionEntryShapeStats(statisticsFactory, TEXT_ID);
+  }
+
+  @Test
+  public void ofReturnsDisabledForNullContext() {
+    assertThat(RegionEntryShapeStats.of(null)).isSameAs(RegionEntryShapeStats.DISABLED);
+  }
+
+  @Test
+  public void ofReturnsDisabledWhenContextHasNoStats() {
+    RegionEntryContext context = mock(RegionEntryContext.class);
+
+    assertThat(RegionEntryShapeStats.of(context)).isSameAs(RegionEntryShapeStats.DISABLED);
+  }
+
+  @Test
+  public void ofReturnsStatsOfContext() {
+    RegionEntryContext context = mock(RegionEntryContext.class);
+    when(context.getEntryShapeStats()).thenReturn(shapeStats);
+
+    assertThat(RegionEntryShapeStats.of(context)).isSameAs(shapeStats);
+  }
+
+  @Test
+  public void recordStringKeyLengthUsesBucketBoundaries() {
+    shapeStats.recordStringKeyLength(0);
+    shapeStats.recordStringKeyLength(3);
+    shapeStats.recordStringKeyLength(8);
+    shapeStats.recordStringKeyLength(15);
+    shapeStats.recordStringKeyLength(16);
+    shapeStats.recordStringKeyLength(64);
+
+    assertThat(statistics.getLong(stringKeysLength0To3Id)).isEqualTo(2);
+    assertThat(statistics.getLong(stringKeysLength8To15Id)).isEqualTo(2);
+    assertThat(statistics.getLong(stringKeysLength16To31Id)).isEqualTo(1);
+    assertThat(statistics.getLong(stringKeysLength64AndOverId)).isEqualTo(1);
+  }
+
+  @Test
+  public void canStringBeInlineEncodedRecordsTooLong() {
+    assertThat(InlineKeyHelper.canStringBeInlineEncoded("0123456789abcdef", shapeStats)).isNull();
+
+    assertThat(statistics.getLong(stringKeyTooLongId)).isEqualTo(1);
+    assertThat(statistics.getLong(stringKeyNotByteEncodableId)).isZero();
+    assertThat(statistics.getLong(stringKeysLength16To31Id)).isEqualTo(1);
+  }
+
+  @Test
+  public void canStringBeInlineEncodedRecordsNotByteEncodable() {
+    String nonAscii = "\u00e9\u00e9\u00e9\u00e9\u00e9\u00e9\u00e9\u00e9";
+
+    assertThat(InlineKeyHelper.canStringBeInlineEncoded(nonAscii, shapeStats)).isNull();
+
+    assertThat(statistics.getLong(stringKeyNotByteEncodableId)).isEqualTo(1);
+    assertThat(statistics.getLong(stringKeyTooLongId)).isZero();
+  }
+
+  @Test
+  public void canStringBeInlineEncodedRecordsNoFailureForInlineableKeys() {
+    assertThat(InlineKeyHelper.canStringBeInlineEncoded("key", shapeStats)).isTrue();
+    assertThat(InlineKeyHelper.canStringBeInlineEncoded("\u00e9", shapeStats)).isFalse();
+
+    assertThat(statistics.getLong(stringKeyTooLongId)).isZero();
+    assertThat(statistics.getLong(stringKeyNotByteEncodableId)).isZero();
+    assertThat(statistics.getLong(stringKeysLength0To3Id)).isEqualTo(2);
+  }
+
+  @Test
+  public void getValuesReturnsEveryStatistic() {
+    shapeStats.incObjectKeyEntries();
+
+    assertThat(shapeStats.getValues())
+        .hasSize(RegionEntryShapeStats.getStatisticsType().getStatistics().length)
+        .containsEntry("objectKeyEntries", statistics.getLong(objectKeyEntriesId))
+        .containsEntry("intKeyEntries", 0L);
+  }
+}
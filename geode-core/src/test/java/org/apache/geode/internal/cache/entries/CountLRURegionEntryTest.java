@@ -0,0 +1,106 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.cache.entries;
+
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.verify;
+import static org.mockito.Mockito.when;
+
+import org.junit.Before;
+import org.junit.Test;
+
+import org.apache.geode.internal.cache.RegionEntryContext;
+import org.apache.geode.internal.cache.Token;
+import org.apache.geode.internal.cache.eviction.EvictionController;
+
+public class CountLRURegionEntryTest {
+
+  private RegionEntryContext context;
+  private EvictionController evictionController;
+
+  @Before
+  public void setup() {
+    context = mock(RegionEntryContext.class);
+    evictionController = mock(EvictionController.class);
+  }
+
+  @Test
+  public void entrySizeIsInitiallyZero() {
+    VMThinCountLRURegionEntryHeapObjectKey entry =
+        new VMThinCountLRURegionEntryHeapObjectKey(context, "key", "value");
+
+    assertThat(entry.getEntrySize()).isEqualTo(0);
+  }
+
+  @Test
+  public void updateEntrySizeReturnsDeltaOnlyWhenSizeChanges() {
+    VMThinCountLRURegionEntryHeapObjectKey entry =
+        new VMThinCountLRURegionEntryHeapObjectKey(context, "key", "value");
+    when(evictionController.entrySize(any(), any())).thenReturn(1);
+
+    assertThat(entry.updateEntrySize(evictionController, "value")).isEqualTo(1);
+    assertThat(entry.getEntrySize()).isEqualTo(1);
+    assertThat(entry.updateEntrySize(evictionController, "value")).isEqualTo(0);
+    assertThat(entry.getEntrySize()).isEqualTo(1);
+
+    when(evictionController.entrySize(any(), any())).thenReturn(0);
+
+    assertThat(entry.updateEntrySize(evictionController, Token.DESTROYED)).isEqualTo(-1);
+    assertThat(entry.getEntrySize()).isEqualTo(0);
+    assertThat(entry.updateEntrySize(evictionController, Token.DESTROYED)).isEqualTo(0);
+  }
+
+  @Test
+  public void updateEntrySizeWithoutValueSizesTheValueToken() {
+    VMThinCountLRURegionEntryHeapObjectKey entry =
+        new VMThinCountLRURegionEntryHeapObjectKey(context, "key", "value");
+    when(evictionController.entrySize(any(), any())).thenReturn(1);
+
+    assertThat(entry.updateEntrySize(evictionController)).isEqualTo(1);
+
+    verify(evictionController).entrySize("key", Token.NOT_A_TOKEN);
+  }
+
+  @Test
+  public void entrySizeDoesNotChangeLastModified() {
+    VMThinCountLRURegionEntryHeapObjectKey entry =
+        new VMThinCountLRURegionEntryHeapObjectKey(context, "key", "value");
+    entry._setLastModified(1234L);
+    when(evictionController.entrySize(any(), any())).thenReturn(1);
+
+    entry.updateEntrySize(evictionController, "value");
+    assertThat(entry.getLastModified()).isEqualTo(1234L);
+
+    entry._setLastModified(5678L);
+    assertThat(entry.getEntrySize()).isEqualTo(1);
+  }
+
+  @Test
+  public void entrySizeIsIndependentOfOtherEvictionBits() {
+    VMThinCountLRURegionEntryHeapObjectKey entry =
+        new VMThinCountLRURegionEntryHeapObjectKey(context, "key", "value");
+    when(evictionController.entrySize(any(), any())).thenReturn(1);
+    entry.updateEntrySize(evictionController, "value");
+
+    entry.setEvicted();
+    entry.setRecentlyUsed(context);
+    entry.unsetEvicted();
+    entry.unsetRecentlyUsed();
+
+    assertThat(entry.getEntrySize()).isEqualTo(1);
+  }
+}
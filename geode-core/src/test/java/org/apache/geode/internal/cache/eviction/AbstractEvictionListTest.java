@@ -20,6 +20,8 @@ import static org.mockito.Mockito.never;
 import static org.mockito.Mockito.verify;
 import static org.mockito.Mockito.when;
 
+import java.util.Arrays;
+
 import org.junit.Before;
 import org.junit.Rule;
 import org.junit.Test;
@@ -62,6 +64,21 @@ public class AbstractEvictionListTest {
     assertThat(evictionList.size()).isEqualTo(2);
   }
 
+  @Test
+  public void appendEntriesAppendsEachEntryOnce() throws Exception {
+    TestEvictionList evictionList = new TestEvictionList(controller);
+    EvictionNode node1 = new LinkableEvictionNode();
+    EvictionNode node2 = new LinkableEvictionNode();
+
+    evictionList.appendEntry(node1);
+    evictionList.appendEntries(Arrays.asList(node1, node2));
+
+    assertThat(evictionList.size()).isEqualTo(2);
+    assertThat(evictionList.head.next()).isSameAs(node1);
+    assertThat(node1.next()).isSameAs(node2);
+    assertThat(node2.next()).isSameAs(evictionList.tail);
+  }
+
   @Test
   public void sizeDecreasedWhenDecremented() throws Exception {
     TestEvictionList evictionList = new TestEvictionList(controller);
@@ -545,6 +545,20 @@ public class RegionMapDestroyTest {
     verify(owner, times(1)).updateSizeOnRemove(any(), anyInt());
   }
 
+  @Test
+  public void destroyOfExistingEntryCountsBulkLoadEntryBeforeUpdateSizeOnRemove() {
+    givenConcurrencyChecks(false);
+    givenExistingEntry();
+    givenInTokenMode();
+
+    doDestroy();
+
+    verifyDestroyReturnedTrue();
+    InOrder inOrder = inOrder(regionMap, owner);
+    inOrder.verify(regionMap, times(1)).countBulkLoadEntry(existingRegionEntry);
+    inOrder.verify(owner, times(1)).updateSizeOnRemove(any(), anyInt());
+  }
+
   @Test
   public void destroyOfExistingTombstoneInTokenModeWithConcurrencyChecksDoesNothing()
       throws Exception {
@@ -668,6 +682,7 @@ public class RegionMapDestroyTest {
     verifyDestroyReturnedTrue();
     verify(regionMap, times(2)).getEntry(any());
     verify(regionMap, times(1)).processVersionTag(existingRegionEntry, event);
+    verify(regionMap, times(1)).countBulkLoadEntry(existingRegionEntry);
     verify(regionMap, times(1)).lruEntryDestroy(existingRegionEntry);
     verifyNoMoreInteractions(regionMap);
     verifyEntryDestroyed(existingRegionEntry, false);
@@ -21,6 +21,7 @@ import static org.assertj.core.api.Assertions.assertThatThrownBy;
 import static org.mockito.AdditionalMatchers.not;
 import static org.mockito.ArgumentMatchers.any;
 import static org.mockito.ArgumentMatchers.anyBoolean;
+import static org.mockito.ArgumentMatchers.anyInt;
 import static org.mockito.ArgumentMatchers.anyLong;
 import static org.mockito.ArgumentMatchers.eq;
 import static org.mockito.ArgumentMatchers.same;
@@ -52,6 +53,7 @@ import org.apache.geode.internal.cache.InternalRegion;
 import org.apache.geode.internal.cache.RegionClearedException;
 import org.apache.geode.internal.cache.RegionEntry;
 import org.apache.geode.internal.cache.RegionEntryFactory;
+import org.apache.geode.internal.cache.RegionMapBulkLoad;
 import org.apache.geode.internal.cache.Token;
 import org.apache.geode.internal.cache.versions.ConcurrentCacheModificationException;
 import org.apache.geode.internal.cache.versions.VersionStamp;
@@ -780,6 +782,23 @@ public class RegionMapPutTest {
     verify(focusedRegionMap, never()).lruEntryCreate(createdRegionEntry);
   }
 
+  @Test
+  public void createDuringBulkLoad_recordsEntryInBulkLoadInsteadOfUpdatingSizeAndLru() {
+    ifNew = true;
+    when(event.getOperation()).thenReturn(Operation.CREATE);
+    when(event.getNewValueBucketSize()).thenReturn(42);
+    RegionMapBulkLoad bulkLoad = mock(RegionMapBulkLoad.class);
+    when(bulkLoad.entryCreated(createdRegionEntry, 42)).thenReturn(true);
+    when(focusedRegionMap.getBulkLoad()).thenReturn(bulkLoad);
+
+    doPut();
+
+    verify(bulkLoad, times(1)).entryCreated(createdRegionEntry, 42);
+    verify(bulkLoad, times(1)).flush();
+    verify(focusedRegionMap, never()).lruEntryCreate(any());
+    verify(internalRegion, never()).updateSizeOnCreate(any(), anyInt());
+  }
+
   @Test
   public void lruEnryUpdateCalled_ifUpdateDoneWithoutAClear() throws Exception {
     ifOld = true;
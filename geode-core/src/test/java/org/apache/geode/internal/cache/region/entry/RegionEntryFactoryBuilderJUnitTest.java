@@ -77,4 +77,39 @@ public class RegionEntryFactoryBuilderJUnitTest {
             .create(enableStats, enableLRU, enableDisk, enableVersioning, enableOffHeap).getClass()
             .getSimpleName());
   }
+
+  /**
+   * Entry count LRU regions get the factories of the entries that keep their size in a state bit.
+   * The conditionals are: enableStats, enableDisk, enableVersion, enableOffHeap
+   */
+  @Test
+  @Parameters({"VMThinCountLRURegionEntryHeapFactory,false,false,false,false",
+      "VMThinCountLRURegionEntryOffHeapFactory,false,false,false,true",
+      "VersionedThinCountLRURegionEntryHeapFactory,false,false,true,false",
+      "VersionedThinCountLRURegionEntryOffHeapFactory,false,false,true,true",
+      "VMThinDiskCountLRURegionEntryHeapFactory,false,true,false,false",
+      "VMThinDiskCountLRURegionEntryOffHeapFactory,false,true,false,true",
+      "VersionedThinDiskCountLRURegionEntryHeapFactory,false,true,true,false",
+      "VersionedThinDiskCountLRURegionEntryOffHeapFactory,false,true,true,true",
+      "VMStatsCountLRURegionEntryHeapFactory,true,false,false,false",
+      "VMStatsCountLRURegionEntryOffHeapFactory,true,false,false,true",
+      "VersionedStatsCountLRURegionEntryHeapFactory,true,false,true,false",
+      "VersionedStatsCountLRURegionEntryOffHeapFactory,true,false,true,true",
+      "VMStatsDiskCountLRURegionEntryHeapFactory,true,true,false,false",
+      "VMStatsDiskCountLRURegionEntryOffHeapFactory,true,true,false,true",
+      "VersionedStatsDiskCountLRURegionEntryHeapFactory,true,true,true,false",
+      "VersionedStatsDiskCountLRURegionEntryOffHeapFactory,true,true,true,true"})
+  public void testEntryCountLRURegionEntryFactory(String factoryName, boolean enableStats,
+      boolean enableDisk, boolean enableVersioning, boolean enableOffHeap) {
+    assertEquals(factoryName,
+        regionEntryFactoryBuilder
+            .create(enableStats, true, true, enableDisk, enableVersioning, enableOffHeap)
+            .getClass().getSimpleName());
+  }
+
+  @Test
+  public void entryCountLRUIsIgnoredWithoutLRU() {
+    assertEquals("VMThinRegionEntryHeapFactory", regionEntryFactoryBuilder
+        .create(false, false, true, false, false, false).getClass().getSimpleName());
+  }
 }
@@ -0,0 +1,107 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.compression;
+
+import static org.apache.geode.test.awaitility.GeodeAwaitility.await;
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.assertj.core.api.Assertions.assertThatThrownBy;
+
+import java.nio.charset.StandardCharsets;
+
+import org.junit.Test;
+
+import org.apache.geode.compression.CompressionException;
+import org.apache.geode.compression.Compressor;
+import org.apache.geode.compression.DictionaryCompressor;
+
+/**
+ * Tests the dictionary {@link Compressor}.
+ */
+public class DictionaryCompressorJUnitTest {
+
+  private static final int SAMPLE_COUNT = 100;
+
+  private static byte[] createValue(int id) {
+    return ("{\"id\":" + id + ",\"name\":\"account-" + id
+        + "\",\"city\":\"Portland\",\"status\":\"ACTIVE\",\"currency\":\"USD\","
+        + "\"notes\":\"standard account, monthly statements, paperless billing\"}")
+            .getBytes(StandardCharsets.UTF_8);
+  }
+
+  @Test
+  public void compressAndDecompressWithoutDictionary() {
+    DictionaryCompressor compressor = new DictionaryCompressor(SAMPLE_COUNT, 1024);
+    byte[] value = createValue(1);
+
+    byte[] compressed = compressor.compress(value);
+
+    assertThat(compressor.getDictionaryVersion()).isZero();
+    assertThat(compressor.decompress(compressed)).isEqualTo(value);
+    assertThat(compressor.decompress(compressor.compress(new byte[0]))).isEmpty();
+  }
+
+  @Test
+  public void trainsDictionaryFromSampledValues() {
+    DictionaryCompressor compressor = new DictionaryCompressor(SAMPLE_COUNT, 1024);
+    byte[] compressedWithoutDictionary = compressor.compress(createValue(0));
+    for (int i = 1; i < SAMPLE_COUNT; i++) {
+      compressor.compress(createValue(i));
+    }
+    awaitDictionaryVersion(compressor, 1);
+
+    byte[] value = createValue(SAMPLE_COUNT);
+    byte[] compressed = compressor.compress(value);
+
+    assertThat(compressed.length).isLessThan(value.length / 3)
+        .isLessThan(compressedWithoutDictionary.length);
+    assertThat(compressor.decompress(compressed)).isEqualTo(value);
+    assertThat(compressor.decompress(compressedWithoutDictionary)).isEqualTo(createValue(0));
+  }
+
+  @Test
+  public void retrainKeepsOlderDictionaries() {
+    DictionaryCompressor compressor = new DictionaryCompressor(SAMPLE_COUNT, 1024);
+    assertThat(compressor.retrain()).isFalse();
+    for (int i = 0; i < SAMPLE_COUNT; i++) {
+      compressor.compress(createValue(i));
+    }
+    awaitDictionaryVersion(compressor, 1);
+    byte[] compressedWithVersion1 = compressor.compress(createValue(1));
+
+    assertThat(compressor.retrain()).isTrue();
+    assertThat(compressor.retrain()).isFalse();
+    for (int i = 0; i < SAMPLE_COUNT; i++) {
+      byte[] value = ("a value of another shape, number " + i).getBytes(StandardCharsets.UTF_8);
+      compressor.compress(value);
+    }
+
+    awaitDictionaryVersion(compressor, 2);
+    assertThat(compressor.decompress(compressedWithVersion1)).isEqualTo(createValue(1));
+  }
+
+  @Test
+  public void decompressWithUnknownDictionaryVersionThrows() {
+    DictionaryCompressor compressor = new DictionaryCompressor(SAMPLE_COUNT, 1024);
+    byte[] compressed = compressor.compress(createValue(1));
+    compressed[0] = 1;
+
+    assertThatThrownBy(() -> compressor.decompress(compressed))
+        .isInstanceOf(CompressionException.class);
+  }
+
+  private static void awaitDictionaryVersion(DictionaryCompressor compressor, int version) {
+    await().untilAsserted(() -> assertThat(compressor.getDictionaryVersion()).isEqualTo(version));
+  }
+}
@@ -0,0 +1,176 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.offheap;
+
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.mockito.ArgumentMatchers.anyLong;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.when;
+
+import java.util.Collections;
+import java.util.concurrent.atomic.AtomicLong;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import org.apache.geode.StatisticsFactory;
+import org.apache.geode.cache.RegionAttributes;
+import org.apache.geode.internal.cache.InternalCache;
+import org.apache.geode.internal.cache.InternalRegion;
+import org.apache.geode.internal.cache.RegionEntry;
+import org.apache.geode.internal.cache.RegionMap;
+import org.apache.geode.internal.cache.entries.OffHeapRegionEntry;
+import org.apache.geode.internal.statistics.LocalStatisticsFactory;
+
+public class OffHeapCompactorTest {
+
+  private MemoryAllocatorImpl ma;
+  private OffHeapMemoryStats stats;
+  private InternalCache cache;
+
+  @Before
+  public void setUp() {
+    StatisticsFactory statsFactory = new LocalStatisticsFactory(null);
+    ma = (MemoryAllocatorImpl) OffHeapStorage.basicCreateOffHeapStorage(statsFactory,
+        1024 * 1024, mock(OutOfOffHeapMemoryListener.class));
+    stats = ma.getStats();
+    cache = mock(InternalCache.class);
+  }
+
+  @After
+  public void tearDown() {
+    MemoryAllocatorImpl.freeOffHeapMemory();
+  }
+
+  private static byte[] createValue(int size) {
+    byte[] value = new byte[size];
+    for (int i = 0; i < size; i++) {
+      value[i] = (byte) i;
+    }
+    return value;
+  }
+
+  private static OffHeapRegionEntry createEntry(long address) {
+    AtomicLong entryAddress = new AtomicLong(address);
+    OffHeapRegionEntry re = mock(OffHeapRegionEntry.class);
+    when(re.getAddress()).thenAnswer(invocation -> entryAddress.get());
+    when(re.setAddress(anyLong(), anyLong())).thenAnswer(invocation -> entryAddress
+        .compareAndSet(invocation.getArgument(0), invocation.getArgument(1)));
+    return re;
+  }
+
+  private OffHeapRegionEntry createEntryAfterFreeSpace(byte[] value) {
+    StoredObject filler = ma.allocate(1000);
+    StoredObject storedValue = ma.allocateAndInitialize(value, true, false);
+    filler.release();
+    return createEntry(storedValue.getAddress());
+  }
+
+  @Test
+  public void relocateMovesValueToLowerAddress() {
+    byte[] value = createValue(100);
+    OffHeapRegionEntry re = createEntryAfterFreeSpace(value);
+    long oldAddress = re.getAddress();
+    OffHeapCompactor compactor = new OffHeapCompactor(cache, ma, 0, 0);
+
+    assertThat(compactor.needsCompaction()).isTrue();
+    assertThat(compactor.relocate(re)).isEqualTo(100);
+
+    assertThat(re.getAddress()).isLessThan(oldAddress);
+    assertThat(OffHeapStoredObject.getRefCount(oldAddress)).isZero();
+    OffHeapStoredObject moved = new OffHeapStoredObject(re.getAddress());
+    assertThat(moved.getRefCount()).isEqualTo(1);
+    assertThat(moved.isSerialized()).isTrue();
+    assertThat(moved.isCompressed()).isFalse();
+    assertThat(moved.getSerializedValue()).isEqualTo(value);
+    assertThat(stats.getObjects()).isEqualTo(1);
+    assertThat(stats.getCompactionObjectsMoved()).isEqualTo(1);
+    assertThat(stats.getCompactionBytesMoved()).isEqualTo(100);
+  }
+
+  @Test
+  public void relocateSkipsValueRetainedByOthers() {
+    OffHeapRegionEntry re = createEntryAfterFreeSpace(createValue(100));
+    long oldAddress = re.getAddress();
+    OffHeapStoredObject.retain(oldAddress);
+    OffHeapCompactor compactor = new OffHeapCompactor(cache, ma, 0, 0);
+    compactor.needsCompaction();
+
+    assertThat(compactor.relocate(re)).isZero();
+
+    assertThat(re.getAddress()).isEqualTo(oldAddress);
+    assertThat(OffHeapStoredObject.getRefCount(oldAddress)).isEqualTo(2);
+    assertThat(stats.getCompactionObjectsMoved()).isZero();
+  }
+
+  @Test
+  public void relocateSkipsValueWithoutFreeSpaceBelowIt() {
+    StoredObject storedValue = ma.allocateAndInitialize(createValue(100), true, false);
+    OffHeapRegionEntry re = createEntry(storedValue.getAddress());
+    OffHeapCompactor compactor = new OffHeapCompactor(cache, ma, 0, 0);
+    compactor.needsCompaction();
+
+    assertThat(compactor.relocate(re)).isZero();
+
+    assertThat(re.getAddress()).isEqualTo(storedValue.getAddress());
+    assertThat(storedValue.getRefCount()).isEqualTo(1);
+  }
+
+  @Test
+  public void relocateIgnoresEncodedValues() {
+    long address =
+        OffHeapRegionEntryHelper.encodeDataAsAddress(new byte[] {1, 2, 3}, false, false);
+    OffHeapRegionEntry re = createEntry(address);
+    OffHeapCompactor compactor = new OffHeapCompactor(cache, ma, 0, 0);
+
+    assertThat(compactor.relocate(re)).isZero();
+
+    assertThat(re.getAddress()).isEqualTo(address);
+  }
+
+  @Test
+  public void compactRelocatesEntriesOfOffHeapRegions() {
+    OffHeapRegionEntry re = createEntryAfterFreeSpace(createValue(100));
+    long oldAddress = re.getAddress();
+    InternalRegion region = mock(InternalRegion.class);
+    RegionAttributes attributes = mock(RegionAttributes.class);
+    RegionMap regionMap = mock(RegionMap.class);
+    when(region.getAttributes()).thenReturn(attributes);
+    when(attributes.getOffHeap()).thenReturn(true);
+    when(region.getRegionMap()).thenReturn(regionMap);
+    when(regionMap.regionEntries()).thenReturn(Collections.<RegionEntry>singletonList(re));
+    when(cache.getAllRegions()).thenReturn(Collections.singleton(region));
+    OffHeapCompactor compactor = new OffHeapCompactor(cache, ma, 1024 * 1024, 0);
+
+    compactor.compact();
+
+    assertThat(re.getAddress()).isLessThan(oldAddress);
+    assertThat(stats.getCompactions()).isEqualTo(1);
+    assertThat(stats.getCompactionObjectsMoved()).isEqualTo(1);
+  }
+
+  @Test
+  public void compactDoesNothingBelowFragmentationThreshold() {
+    OffHeapRegionEntry re = createEntryAfterFreeSpace(createValue(100));
+    long oldAddress = re.getAddress();
+    OffHeapCompactor compactor = new OffHeapCompactor(cache, ma, 0, 101);
+
+    compactor.compact();
+
+    assertThat(re.getAddress()).isEqualTo(oldAddress);
+    assertThat(stats.getCompactions()).isZero();
+  }
+}
@@ -41,10 +41,16 @@ import org.apache.geode.internal.cache.EntryEventImpl;
 import org.apache.geode.internal.cache.RegionEntryContext;
 import org.apache.geode.internal.cache.Token;
 import org.apache.geode.internal.cache.VMCachedDeserializable;
+import org.apache.geode.internal.cache.entries.AbstractRegionEntry;
 import org.apache.geode.internal.cache.entries.DiskEntry;
 import org.apache.geode.internal.cache.entries.OffHeapRegionEntry;
+import org.apache.geode.internal.cache.entries.SerializedKeyRegionEntry;
+import org.apache.geode.internal.cache.entries.VMThinRegionEntryOffHeapSerializedKey;
 import org.apache.geode.internal.cache.entries.VersionedStatsDiskRegionEntryOffHeap;
 import org.apache.geode.internal.serialization.DSCODE;
+import org.apache.geode.internal.util.concurrent.ConcurrentMapWithReusableEntries;
+import org.apache.geode.internal.util.concurrent.CustomEntryBinnedConcurrentHashMap;
+import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap;
 
 @RunWith(PowerMockRunner.class)
 @PowerMockIgnore("*.UnitTest")
@@ -907,6 +913,121 @@ public class OffHeapRegionEntryHelperJUnitTest {
     OffHeapRegionEntryHelper.setValue(re, Token.REMOVED_PHASE2);
   }
 
+  @Test
+  public void storeKeyOffHeapShouldMoveSerializedKeyOffHeap() {
+    String key = "a key that is too long to be encoded in an address";
+    SerializedKeyRegionEntry re = new VMThinRegionEntryOffHeapSerializedKey(null, key, null);
+
+    OffHeapRegionEntryHelper.storeKeyOffHeap(re);
+
+    assertThat(re.getHeapKey()).isNull();
+    assertThat(OffHeapRegionEntryHelper.isOffHeap(re.getKeyAddress())).isTrue();
+    assertThat(re.getKey()).isEqualTo(key).isNotSameAs(key);
+    assertThat(re.isKeyEqual(new String(key))).isTrue();
+    assertThat(re.isKeyEqual("another key")).isFalse();
+    assertThat(re.isKeyEqual(1)).isFalse();
+  }
+
+  @Test
+  public void storeKeyOffHeapShouldEncodeSmallKeyInAddress() {
+    SerializedKeyRegionEntry re = new VMThinRegionEntryOffHeapSerializedKey(null, 7, null);
+
+    OffHeapRegionEntryHelper.storeKeyOffHeap(re);
+
+    assertThat(re.getHeapKey()).isNull();
+    assertThat(OffHeapRegionEntryHelper.isOffHeap(re.getKeyAddress())).isFalse();
+    assertThat(re.getKey()).isEqualTo(7);
+    assertThat(re.isKeyEqual(7)).isTrue();
+    assertThat(re.isKeyEqual(8)).isFalse();
+  }
+
+  @Test
+  public void storeKeyOffHeapShouldKeepKeyThatCanNotBeSerializedOnHeap() {
+    Object key = new Object();
+    SerializedKeyRegionEntry re = new VMThinRegionEntryOffHeapSerializedKey(null, key, null);
+
+    OffHeapRegionEntryHelper.storeKeyOffHeap(re);
+
+    assertThat(re.getHeapKey()).isSameAs(key);
+    assertThat(re.getKeyAddress()).isZero();
+    assertThat(re.isKeyEqual(key)).isTrue();
+  }
+
+  @Test
+  public void setValueToRemovePhase2ShouldKeepOffHeapKey() {
+    String key = "a key that is too long to be encoded in an address";
+    SerializedKeyRegionEntry re = new VMThinRegionEntryOffHeapSerializedKey(null, key, null);
+    OffHeapRegionEntryHelper.storeKeyOffHeap(re);
+    long keyAddress = re.getKeyAddress();
+
+    OffHeapRegionEntryHelper.setValue(re, Token.REMOVED_PHASE2);
+
+    // the entry may still be in its map, where it is found by its key
+    assertThat(re.getKeyAddress()).isEqualTo(keyAddress);
+    assertThat(re.getHeapKey()).isNull();
+    assertThat(re.isKeyEqual(key)).isTrue();
+  }
+
+  @Test
+  public void releaseKeyShouldReleaseOffHeapKeyWithoutMovingItToTheHeap() {
+    String key = "a key that is too long to be encoded in an address";
+    SerializedKeyRegionEntry re = new VMThinRegionEntryOffHeapSerializedKey(null, key, null);
+    long usedMemory = ma.getUsedMemory();
+    OffHeapRegionEntryHelper.storeKeyOffHeap(re);
+    assertThat(ma.getUsedMemory()).isGreaterThan(usedMemory);
+
+    OffHeapRegionEntryHelper.releaseKey(re);
+
+    assertThat(ma.getUsedMemory()).isEqualTo(usedMemory);
+    assertThat(re.getKeyAddress()).isZero();
+    assertThat(re.getHeapKey()).isNull();
+    assertThat(re.getKey()).isNull();
+    assertThat(re.isKeyEqual(key)).isFalse();
+  }
+
+  @Test
+  public void returnKeyToHeapShouldReleaseOffHeapKeyAndKeepGivenKey() {
+    String key = "a key that is too long to be encoded in an address";
+    SerializedKeyRegionEntry re = new VMThinRegionEntryOffHeapSerializedKey(null, key, null);
+    long usedMemory = ma.getUsedMemory();
+    OffHeapRegionEntryHelper.storeKeyOffHeap(re);
+
+    OffHeapRegionEntryHelper.returnKeyToHeap(re, key);
+
+    assertThat(ma.getUsedMemory()).isEqualTo(usedMemory);
+    assertThat(re.getKeyAddress()).isZero();
+    assertThat(re.getHeapKey()).isSameAs(key);
+    assertThat(re.getKey()).isSameAs(key);
+    assertThat(re.isKeyEqual(key)).isTrue();
+  }
+
+  @Test
+  public void removingEntryFromSegmentedMapShouldReleaseOffHeapKey() {
+    verifyRemovingEntryReleasesOffHeapKey(new CustomEntryConcurrentHashMap<>(16, 0.75f, 16, false,
+        new AbstractRegionEntry.HashRegionEntryCreator()));
+  }
+
+  @Test
+  public void removingEntryFromBinnedMapShouldReleaseOffHeapKey() {
+    verifyRemovingEntryReleasesOffHeapKey(new CustomEntryBinnedConcurrentHashMap<>(16, 0.75f, 16,
+        false, new AbstractRegionEntry.HashRegionEntryCreator()));
+  }
+
+  private void verifyRemovingEntryReleasesOffHeapKey(
+      ConcurrentMapWithReusableEntries<Object, Object> map) {
+    String key = "a key that is too long to be encoded in an address";
+    SerializedKeyRegionEntry re = new VMThinRegionEntryOffHeapSerializedKey(null, key, null);
+    long usedMemory = ma.getUsedMemory();
+    OffHeapRegionEntryHelper.storeKeyOffHeap(re);
+    assertThat(map.putIfAbsent(key, re)).isNull();
+
+    assertThat(map.remove(key, re)).isTrue();
+
+    assertThat(ma.getUsedMemory()).isEqualTo(usedMemory);
+    assertThat(re.getKeyAddress()).isZero();
+    assertThat(map.get(key)).isNull();
+  }
+
   @Test
   public void doWithOffHeapClearShouldSetTheThreadLocalToTrue() {
     // verify that threadlocal is not set
@@ -183,6 +183,10 @@ public class OffHeapStorageJUnitTest {
       assertEquals(1024 * 1024, stats.getLargestFragment());
       assertEquals(0, stats.getObjects());
       assertEquals(0, stats.getReads());
+      assertEquals(0, stats.getCompactions());
+      assertEquals(0, stats.getCompactionTime());
+      assertEquals(0, stats.getCompactionObjectsMoved());
+      assertEquals(0, stats.getCompactionBytesMoved());
 
       stats.incFreeMemory(100);
       assertEquals(1024 * 1024 + 100, stats.getFreeMemory());
@@ -207,6 +211,11 @@ public class OffHeapStorageJUnitTest {
       stats.incReads();
       assertEquals(1, stats.getReads());
 
+      stats.incCompactionObjectsMoved(2);
+      assertEquals(2, stats.getCompactionObjectsMoved());
+      stats.incCompactionBytesMoved(200);
+      assertEquals(200, stats.getCompactionBytesMoved());
+
       stats.setFragmentation(100);
       assertEquals(100, stats.getFragmentation());
       stats.setFragmentation(0);
@@ -234,6 +243,14 @@ public class OffHeapStorageJUnitTest {
         assertEquals(1, stats.getDefragmentations());
         assertEquals(0, stats.getDefragmentationsInProgress());
         assertTrue(stats.getDefragmentationTime() > 0);
+
+        start = stats.startCompaction();
+        while (DistributionStats.getStatTime() == start) {
+          Thread.yield();
+        }
+        stats.endCompaction(start);
+        assertEquals(1, stats.getCompactions());
+        assertTrue(stats.getCompactionTime() > 0);
       } finally {
         DistributionStats.enableClockStats = originalEnableClockStats;
       }
@@ -254,6 +271,10 @@ public class OffHeapStorageJUnitTest {
       assertEquals(0, stats.getLargestFragment());
       assertEquals(0, stats.getObjects());
       assertEquals(0, stats.getReads());
+      assertEquals(0, stats.getCompactions());
+      assertEquals(0, stats.getCompactionTime());
+      assertEquals(0, stats.getCompactionObjectsMoved());
+      assertEquals(0, stats.getCompactionBytesMoved());
 
       OutOfOffHeapMemoryException ex = null;
       try {
@@ -0,0 +1,254 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.internal.util.concurrent;
+
+import static org.assertj.core.api.Assertions.assertThat;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import org.junit.Test;
+
+import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap.MapCallback;
+import org.apache.geode.internal.util.concurrent.CustomEntryConcurrentHashMap.MapCallbackAdapter;
+
+public class CustomEntryBinnedConcurrentHashMapTest {
+
+  private static CustomEntryBinnedConcurrentHashMap<String, Integer> createMap(
+      boolean isIdentityMap) {
+    return new CustomEntryBinnedConcurrentHashMap<>(1, 0.75f, 16, isIdentityMap, null);
+  }
+
+  @Test
+  public void putGetAndRemoveAcrossResizes() {
+    CustomEntryBinnedConcurrentHashMap<String, Integer> map = createMap(false);
+    for (int i = 0; i < 10000; i++) {
+      assertThat(map.put("key" + i, i)).isNull();
+    }
+
+    assertThat(map).hasSize(10000);
+    for (int i = 0; i < 10000; i++) {
+      assertThat(map.get("key" + i)).isEqualTo(i);
+    }
+    assertThat(map.put("key1", -1)).isEqualTo(1);
+    assertThat(map.putIfAbsent("key1", -2)).isEqualTo(-1);
+    assertThat(map.replace("key1", -2, -3)).isFalse();
+    assertThat(map.replace("key1", -1, -3)).isTrue();
+    assertThat(map.remove("key1", -1)).isFalse();
+    assertThat(map.remove("key1")).isEqualTo(-3);
+    assertThat(map.containsKey("key1")).isFalse();
+    assertThat(map).hasSize(9999);
+  }
+
+  @Test
+  public void createWithCallbackCreatesValueOnlyIfThereIsNoMapping() {
+    CustomEntryBinnedConcurrentHashMap<String, Integer> map = createMap(false);
+    AtomicInteger created = new AtomicInteger();
+    List<Integer> read = new ArrayList<>();
+    MapCallback<String, Integer, String, Integer> callback =
+        new MapCallbackAdapter<String, Integer, String, Integer>() {
+          @Override
+          public Integer newValue(String key, String context, Integer createParams) {
+            created.incrementAndGet();
+            return createParams;
+          }
+
+          @Override
+          public void oldValueRead(Integer value) {
+            read.add(value);
+          }
+        };
+
+    assertThat(map.create("key", callback, "context", 1, true)).isEqualTo(1);
+    assertThat(map.create("key", callback, "context", 2, true)).isEqualTo(1);
+    assertThat(map.create("key", callback, "context", 3, false)).isEqualTo(1);
+    assertThat(map.get("key", callback)).isEqualTo(1);
+    assertThat(map.get("missing", callback)).isNull();
+
+    assertThat(created).hasValue(1);
+    assertThat(read).containsExactly(1, 1);
+    assertThat(map.create("key", 4)).isFalse();
+    assertThat(map.create("other", 5)).isTrue();
+    assertThat(map).hasSize(2);
+  }
+
+  @Test
+  public void removeConditionallyRemovesOnlyIfConditionHolds() {
+    CustomEntryBinnedConcurrentHashMap<String, Integer> map = createMap(false);
+    map.put("small", 1);
+    map.put("large", 100);
+    MapCallback<String, Integer, Integer, Object> atLeast =
+        new MapCallbackAdapter<String, Integer, Integer, Object>() {
+          @Override
+          public boolean doRemoveValue(Integer value, Integer context, Object removeParams) {
+            return value >= context;
+          }
+        };
+
+    assertThat(map.removeConditionally("small", atLeast, 10, null)).isNull();
+    assertThat(map.removeConditionally("large", atLeast, 10, null)).isEqualTo(100);
+    assertThat(map.removeConditionally("missing", atLeast, 10, null)).isNull();
+
+    assertThat(map).containsOnlyKeys("small");
+  }
+
+  @Test
+  public void concurrentCreatesWithCallbackCreateEachValueOnce() throws Exception {
+    final CustomEntryBinnedConcurrentHashMap<String, Integer> map = createMap(false);
+    final int threads = 4;
+    final int keys = 20000;
+    final AtomicInteger created = new AtomicInteger();
+    final MapCallback<String, Integer, Object, Integer> callback =
+        new MapCallbackAdapter<String, Integer, Object, Integer>() {
+          @Override
+          public Integer newValue(String key, Object context, Integer createParams) {
+            created.incrementAndGet();
+            return createParams;
+          }
+        };
+    ExecutorService executor = Executors.newFixedThreadPool(threads);
+    try {
+      CountDownLatch start = new CountDownLatch(1);
+      List<Future<?>> futures = new ArrayList<>();
+      for (int t = 0; t < threads; t++) {
+        futures.add(executor.submit(() -> {
+          start.await();
+          for (int i = 0; i < keys; i++) {
+            assertThat(map.create("key" + i, callback, null, i, (i & 1) == 0)).isEqualTo(i);
+          }
+          return null;
+        }));
+      }
+
+      start.countDown();
+      for (Future<?> future : futures) {
+        future.get(60, TimeUnit.SECONDS);
+      }
+    } finally {
+      executor.shutdownNow();
+    }
+
+    assertThat(created).hasValue(keys);
+    assertThat(map).hasSize(keys);
+  }
+
+  @Test
+  public void identityMapComparesKeysByReference() {
+    CustomEntryBinnedConcurrentHashMap<String, Integer> map = createMap(true);
+    String key = new String("key");
+    map.put(key, 1);
+
+    assertThat(map.get(new String("key"))).isNull();
+    assertThat(map.get(key)).isEqualTo(1);
+  }
+
+  @Test
+  public void iteratorsReturnEveryMappingOnce() {
+    CustomEntryBinnedConcurrentHashMap<String, Integer> map = createMap(false);
+    Map<String, Integer> expected = new HashMap<>();
+    for (int i = 0; i < 1000; i++) {
+      map.put("key" + i, i);
+      expected.put("key" + i, i);
+    }
+
+    Map<String, Integer> actual = new HashMap<>();
+    List<Integer> values = new ArrayList<>();
+    for (Map.Entry<String, Integer> entry : map.entrySetWithReusableEntries()) {
+      assertThat(actual.put(entry.getKey(), entry.getValue())).isNull();
+    }
+    values.addAll(map.values());
+
+    assertThat(actual).isEqualTo(expected);
+    assertThat(values).containsExactlyInAnyOrderElementsOf(expected.values());
+    assertThat(map).isEqualTo(expected);
+  }
+
+  @Test
+  public void iteratorRemoveAndClearRemoveMappings() {
+    CustomEntryBinnedConcurrentHashMap<String, Integer> map = createMap(false);
+    for (int i = 0; i < 100; i++) {
+      map.put("key" + i, i);
+    }
+
+    for (Iterator<String> it = map.keySet().iterator(); it.hasNext();) {
+      if (it.next().endsWith("0")) {
+        it.remove();
+      }
+    }
+    assertThat(map).hasSize(90);
+
+    map.clear();
+    assertThat(map).isEmpty();
+    assertThat(map.get("key1")).isNull();
+  }
+
+  @Test
+  public void concurrentReadsFindKeysWhileTableIsResized() throws Exception {
+    final CustomEntryBinnedConcurrentHashMap<String, Integer> map = createMap(false);
+    final int writers = 4;
+    final int keysPerWriter = 20000;
+    map.put("stable", 0);
+    ExecutorService executor = Executors.newFixedThreadPool(writers + 1);
+    try {
+      CountDownLatch start = new CountDownLatch(1);
+      List<Future<?>> futures = new ArrayList<>();
+      for (int w = 0; w < writers; w++) {
+        final int writer = w;
+        futures.add(executor.submit(() -> {
+          start.await();
+          for (int i = 0; i < keysPerWriter; i++) {
+            String key = writer + "-" + i;
+            map.put(key, i);
+            assertThat(map.get(key)).isEqualTo(i);
+          }
+          return null;
+        }));
+      }
+      Future<Integer> reader = executor.submit(() -> {
+        start.await();
+        int reads = 0;
+        do {
+          assertThat(map.get("stable")).isEqualTo(0);
+          reads++;
+        } while (map.size() < writers * keysPerWriter + 1);
+        return reads;
+      });
+
+      start.countDown();
+      for (Future<?> future : futures) {
+        future.get(60, TimeUnit.SECONDS);
+      }
+      assertThat(reader.get(60, TimeUnit.SECONDS)).isGreaterThan(0);
+    } finally {
+      executor.shutdownNow();
+    }
+
+    assertThat(map).hasSize(writers * keysPerWriter + 1);
+    for (int w = 0; w < writers; w++) {
+      for (int i = 0; i < keysPerWriter; i++) {
+        assertThat(map.get(w + "-" + i)).isEqualTo(i);
+      }
+    }
+  }
+}
@@ -0,0 +1,96 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.management.internal.cli.commands;
+
+import java.util.List;
+import java.util.Set;
+
+import org.springframework.shell.core.annotation.CliCommand;
+import org.springframework.shell.core.annotation.CliOption;
+
+import org.apache.geode.distributed.DistributedMember;
+import org.apache.geode.management.HotKeyData;
+import org.apache.geode.management.cli.CliMetaData;
+import org.apache.geode.management.cli.ConverterHint;
+import org.apache.geode.management.cli.GfshCommand;
+import org.apache.geode.management.internal.cli.functions.GetHotKeysFunction;
+import org.apache.geode.management.internal.cli.result.model.ResultModel;
+import org.apache.geode.management.internal.cli.result.model.TabularResultModel;
+import org.apache.geode.management.internal.functions.CliFunctionResult;
+import org.apache.geode.management.internal.i18n.CliStrings;
+import org.apache.geode.management.internal.security.ResourceOperation;
+import org.apache.geode.security.ResourcePermission;
+
+public class ShowHotKeysCommand extends GfshCommand {
+  private final GetHotKeysFunction getHotKeysFunction = new GetHotKeysFunction();
+
+  @CliCommand(value = CliStrings.SHOW_HOT_KEYS, help = CliStrings.SHOW_HOT_KEYS__HELP)
+  @CliMetaData(relatedTopic = {CliStrings.TOPIC_GEODE_REGION, CliStrings.TOPIC_GEODE_STATISTICS})
+  @ResourceOperation(resource = ResourcePermission.Resource.CLUSTER,
+      operation = ResourcePermission.Operation.READ)
+  public ResultModel showHotKeys(
+      @CliOption(key = CliStrings.SHOW_HOT_KEYS__REGION, mandatory = true,
+          optionContext = ConverterHint.REGION_PATH,
+          help = CliStrings.SHOW_HOT_KEYS__REGION__HELP) String regionPath,
+      @CliOption(key = {CliStrings.MEMBER, CliStrings.MEMBERS},
+          optionContext = ConverterHint.MEMBERIDNAME,
+          help = CliStrings.SHOW_HOT_KEYS__MEMBER__HELP) String[] members,
+      @CliOption(key = {CliStrings.GROUP, CliStrings.GROUPS},
+          optionContext = ConverterHint.MEMBERGROUP,
+          help = CliStrings.SHOW_HOT_KEYS__GROUP__HELP) String[] groups,
+      @CliOption(key = CliStrings.SHOW_HOT_KEYS__LIMIT, unspecifiedDefaultValue = "10",
+          help = CliStrings.SHOW_HOT_KEYS__LIMIT__HELP) int limit) {
+    Set<DistributedMember> targetMembers = findMembers(groups, members);
+    targetMembers.retainAll(findMembersForRegion(regionPath));
+
+    if (targetMembers.isEmpty()) {
+      return ResultModel.createError(CliStrings.format(CliStrings.REGION_NOT_FOUND, regionPath));
+    }
+
+    List<CliFunctionResult> results =
+        executeAndGetFunctionResult(getHotKeysFunction, regionPath, targetMembers);
+
+    return buildResultModel(regionPath, limit, results);
+  }
+
+  @SuppressWarnings("unchecked")
+  ResultModel buildResultModel(String regionPath, int limit, List<CliFunctionResult> results) {
+    ResultModel result = new ResultModel();
+    TabularResultModel table = result.addTable("hot-keys");
+    boolean tracked = false;
+    for (CliFunctionResult cliResult : results) {
+      if (!cliResult.isSuccessful() || !(cliResult.getResultObject() instanceof List)) {
+        continue;
+      }
+      tracked = true;
+      List<HotKeyData> hotKeys = (List<HotKeyData>) cliResult.getResultObject();
+      for (int i = 0; i < hotKeys.size() && (limit <= 0 || i < limit); i++) {
+        HotKeyData hotKey = hotKeys.get(i);
+        table.accumulate("Member", cliResult.getMemberIdOrName());
+        table.accumulate("Key", hotKey.getKey());
+        table.accumulate("Ops/sec", String.format("%.1f", hotKey.getOperationsPerSecond()));
+        table.accumulate("Reads", String.valueOf(hotKey.getReads()));
+        table.accumulate("Writes", String.valueOf(hotKey.getWrites()));
+        table.accumulate("Error", String.valueOf(hotKey.getError()));
+      }
+    }
+
+    if (!tracked) {
+      return ResultModel.createError(
+          CliStrings.format(CliStrings.SHOW_HOT_KEYS__NOT_TRACKED, regionPath));
+    }
+    return result;
+  }
+}
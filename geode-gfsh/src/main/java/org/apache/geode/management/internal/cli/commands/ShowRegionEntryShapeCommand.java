@@ -0,0 +1,90 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.management.internal.cli.commands;
+
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+import org.springframework.shell.core.annotation.CliCommand;
+import org.springframework.shell.core.annotation.CliOption;
+
+import org.apache.geode.distributed.DistributedMember;
+import org.apache.geode.management.cli.CliMetaData;
+import org.apache.geode.management.cli.ConverterHint;
+import org.apache.geode.management.cli.GfshCommand;
+import org.apache.geode.management.internal.cli.functions.GetRegionEntryShapeFunction;
+import org.apache.geode.management.internal.cli.result.model.ResultModel;
+import org.apache.geode.management.internal.cli.result.model.TabularResultModel;
+import org.apache.geode.management.internal.functions.CliFunctionResult;
+import org.apache.geode.management.internal.i18n.CliStrings;
+import org.apache.geode.management.internal.security.ResourceOperation;
+import org.apache.geode.security.ResourcePermission;
+
+public class ShowRegionEntryShapeCommand extends GfshCommand {
+  private final GetRegionEntryShapeFunction getRegionEntryShapeFunction =
+      new GetRegionEntryShapeFunction();
+
+  @CliCommand(value = CliStrings.SHOW_REGION_ENTRY_SHAPE,
+      help = CliStrings.SHOW_REGION_ENTRY_SHAPE__HELP)
+  @CliMetaData(relatedTopic = {CliStrings.TOPIC_GEODE_REGION, CliStrings.TOPIC_GEODE_STATISTICS})
+  @ResourceOperation(resource = ResourcePermission.Resource.CLUSTER,
+      operation = ResourcePermission.Operation.READ)
+  public ResultModel showRegionEntryShape(
+      @CliOption(key = CliStrings.SHOW_REGION_ENTRY_SHAPE__REGION, mandatory = true,
+          optionContext = ConverterHint.REGION_PATH,
+          help = CliStrings.SHOW_REGION_ENTRY_SHAPE__REGION__HELP) String regionPath,
+      @CliOption(key = {CliStrings.MEMBER, CliStrings.MEMBERS},
+          optionContext = ConverterHint.MEMBERIDNAME,
+          help = CliStrings.SHOW_REGION_ENTRY_SHAPE__MEMBER__HELP) String[] members,
+      @CliOption(key = {CliStrings.GROUP, CliStrings.GROUPS},
+          optionContext = ConverterHint.MEMBERGROUP,
+          help = CliStrings.SHOW_REGION_ENTRY_SHAPE__GROUP__HELP) String[] groups) {
+    Set<DistributedMember> targetMembers = findMembers(groups, members);
+    targetMembers.retainAll(findMembersForRegion(regionPath));
+
+    if (targetMembers.isEmpty()) {
+      return ResultModel.createError(CliStrings.format(CliStrings.REGION_NOT_FOUND, regionPath));
+    }
+
+    List<CliFunctionResult> results =
+        executeAndGetFunctionResult(getRegionEntryShapeFunction, regionPath, targetMembers);
+
+    return buildResultModel(regionPath, results);
+  }
+
+  @SuppressWarnings("unchecked")
+  ResultModel buildResultModel(String regionPath, List<CliFunctionResult> results) {
+    ResultModel result = new ResultModel();
+    TabularResultModel table = result.addTable("entry-shape");
+    for (CliFunctionResult cliResult : results) {
+      if (!cliResult.isSuccessful() || !(cliResult.getResultObject() instanceof Map)) {
+        continue;
+      }
+      Map<String, Long> values = (Map<String, Long>) cliResult.getResultObject();
+      for (Map.Entry<String, Long> value : values.entrySet()) {
+        table.accumulate("Member", cliResult.getMemberIdOrName());
+        table.accumulate(CliStrings.SHOW_REGION_ENTRY_SHAPE__STATISTIC__HEADER, value.getKey());
+        table.accumulate(CliStrings.SHOW_REGION_ENTRY_SHAPE__VALUE__HEADER,
+            String.valueOf(value.getValue()));
+      }
+    }
+
+    if (table.getRowSize() == 0) {
+      return ResultModel.createError(CliStrings.format(CliStrings.REGION_NOT_FOUND, regionPath));
+    }
+    return result;
+  }
+}
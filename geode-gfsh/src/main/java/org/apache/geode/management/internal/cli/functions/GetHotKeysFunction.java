@@ -0,0 +1,58 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+ * agreements. See the NOTICE file distributed with this work for additional information regarding
+ * copyright ownership. The ASF licenses this file to You under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the License. You may obtain a
+ * copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.apache.geode.management.internal.cli.functions;
+
+import java.util.ArrayList;
+
+import org.apache.geode.cache.Region;
+import org.apache.geode.cache.execute.FunctionContext;
+import org.apache.geode.internal.cache.HotKeySketch;
+import org.apache.geode.internal.cache.InternalCache;
+import org.apache.geode.management.HotKeyData;
+import org.apache.geode.management.cli.CliFunction;
+import org.apache.geode.management.internal.functions.CliFunctionResult;
+import org.apache.geode.management.internal.i18n.CliStrings;
+
+/**
+ * Returns the hot keys the {@link HotKeySketch} of the region whose path is passed as the argument
+ * reports on this member, most frequently accessed first.
+ */
+public class GetHotKeysFunction extends CliFunction<String> {
+  private static final long serialVersionUID = 1L;
+
+  @Override
+  public CliFunctionResult executeFunction(FunctionContext<String> context) {
+    String regionPath = context.getArguments();
+    InternalCache cache =
+        ((InternalCache) context.getCache()).getCacheForProcessingClientRequests();
+    Region<?, ?> region = cache.getRegion(regionPath);
+
+    if (region == null) {
+      return new CliFunctionResult(context.getMemberName(),
+          CliFunctionResult.StatusState.IGNORABLE,
+          CliStrings.format(CliStrings.REGION_NOT_FOUND, regionPath));
+    }
+
+    HotKeySketch hotKeySketch = HotKeySketch.of(region);
+    if (hotKeySketch == null) {
+      return new CliFunctionResult(context.getMemberName(),
+          CliFunctionResult.StatusState.IGNORABLE,
+          CliStrings.format(CliStrings.SHOW_HOT_KEYS__NOT_TRACKED, regionPath));
+    }
+
+    return new CliFunctionResult(context.getMemberName(),
+        new ArrayList<HotKeyData>(hotKeySketch.getHotKeys()));
+  }
+}
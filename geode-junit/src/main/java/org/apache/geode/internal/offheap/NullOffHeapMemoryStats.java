@@ -111,6 +111,40 @@ public class NullOffHeapMemoryStats implements OffHeapMemoryStats {
     return 0;
   }
 
+  @Override
+  public long startCompaction() {
+    return 0;
+  }
+
+  @Override
+  public void endCompaction(long start) {}
+
+  @Override
+  public int getCompactions() {
+    return 0;
+  }
+
+  @Override
+  public long getCompactionTime() {
+    return 0;
+  }
+
+  @Override
+  public void incCompactionObjectsMoved(int value) {}
+
+  @Override
+  public long getCompactionObjectsMoved() {
+    return 0;
+  }
+
+  @Override
+  public void incCompactionBytesMoved(long value) {}
+
+  @Override
+  public long getCompactionBytesMoved() {
+    return 0;
+  }
+
   @Override
   public Statistics getStats() {
     return null;
@@ -225,8 +225,11 @@ public class TestCommand {
     createTestCommand("gc", ResourcePermissions.CLUSTER_MANAGE);
     createTestCommand("netstat --member=server1", ResourcePermissions.CLUSTER_READ);
     createTestCommand("show dead-locks --file=deadlocks.txt", ResourcePermissions.CLUSTER_READ);
+    createTestCommand("show hot-keys --region=RegionA", ResourcePermissions.CLUSTER_READ);
     createTestCommand("show log --member=locator1 --lines=5", ResourcePermissions.CLUSTER_READ);
     createTestCommand("show metrics", ResourcePermissions.CLUSTER_READ);
+    createTestCommand("show region-entry-shape --region=RegionA",
+        ResourcePermissions.CLUSTER_READ);
 
 
     // PDX Commands